@@ -14,6 +14,7 @@
 
 #include <memory>
 
+#include <LogicalProcessorCommon.h>
 #include <SeaplanesTime.h>
 
 namespace Seaplanes {
@@ -54,6 +55,26 @@ public:
   //! \brief Access logical processor.
   virtual auto getLP() -> class ProtoLogicalProcessor & = 0;
 
+  //! \brief Time stamped reflection received by the logical processor.
+  //! \param object_handle The object handle.
+  //! \param values The attributes containing the new value.
+  //! \param time The time stamp of the reflection.
+  //! \param event_retraction_handle The handle to retract the reflection.
+  //! \return True if the policy takes the reflection over, false if the
+  //! logical processor reflects it immediately.
+  virtual auto
+  reflectionReceived(RTI::ObjectHandle /* object_handle */,
+                     const RTI::AttributeHandleValuePairSet & /* values */,
+                     SeaplanesTime /* time */,
+                     RTI::EventRetractionHandle /* event_retraction_handle */)
+      -> bool = 0;
+
+  //! \brief Retraction of an already received message requested.
+  //! \param event_retraction_handle The handle of the retracted message.
+  virtual auto
+  retractionRequested(RTI::EventRetractionHandle /* event_retraction_handle */)
+      -> void = 0;
+
 protected:
   //! \brief ITimeManagementPolicy constructor, protected so the
   //! timeManagementPolicies can use it while federates use the factory builder.
@@ -0,0 +1,84 @@
+//! \file    LogicalProcessorAllocation.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Allocation of the models to the logical processors and cores.
+//!
+//! An allocation lists, for each logical processor, the CPU its simulation
+//! thread is pinned to and the models it runs. It is computed offline by the
+//! seaplanes-allocator tool, from the models profiles written by the logical
+//! processors, and read back by the logical processors, so that all of them
+//! can declare every model and only keep theirs.
+//!
+//! The allocation file has a line per logical processor, comments starting
+//! with #:
+//!
+//!     lp <name> <cpu, - for none> <model> <model> ...
+
+#ifndef LOGICALPROCESSORALLOCATION_H
+#define LOGICALPROCESSORALLOCATION_H
+
+#include <memory>
+#include <vector>
+
+#include <LogicalProcessorCommon.h>
+
+namespace Seaplanes {
+
+//! \brief Type for allocation unique pointer.
+using UpAllocation = std::unique_ptr<class Allocation>;
+
+class Allocation final {
+public:
+  //! \brief Models of a logical processor.
+  struct Partition {
+    Name lp_name{};             //!< Name of the logical processor.
+    int cpu{-1};                //!< CPU of the simulation thread, -1 for none.
+    std::vector<Name> models{}; //!< Names of the models.
+  };
+
+  //! \brief Type for vector of partitions.
+  using VecPartition = std::vector<Partition>;
+
+  //! \brief Allocation factory builder, reading an allocation file.
+  //! \param path The path of the allocation file.
+  //! \return The allocation in unique pointer.
+  //! \throw std::runtime_error If the file cannot be read or is malformed.
+  static UpAllocation create(const Name & /* path */);
+
+  //! \brief Allocation factory builder, from partitions.
+  //! \param partitions The partitions.
+  //! \return The allocation in unique pointer.
+  static UpAllocation create(VecPartition /* partitions */);
+
+  ~Allocation() = default;
+  Allocation(const Allocation &) = delete;
+  void operator=(const Allocation &) = delete;
+  Allocation(Allocation &&) = delete;
+  void operator=(Allocation &&) = delete;
+
+  //! \brief Partitions getter.
+  //! \return The partitions, one per logical processor.
+  const VecPartition &getPartitions() const;
+
+  //! \brief Find the partition of a logical processor.
+  //! \param lp_name The name of the logical processor.
+  //! \return The partition, nullptr if none.
+  const Partition *findPartition(const Name & /* lp_name */) const;
+
+  //! \brief Write the allocation file.
+  //! \param path The path of the allocation file.
+  //! \throw std::runtime_error If the file cannot be written.
+  void write(const Name & /* path */) const;
+
+private:
+  VecPartition __partitions_; //!< Partitions, one per logical processor.
+
+  //! \brief Allocation constructor.
+  //! \param partitions The partitions.
+  explicit Allocation(VecPartition /* partitions */);
+};
+
+} // namespace Seaplanes
+
+#endif // LOGICALPROCESSORALLOCATION_H
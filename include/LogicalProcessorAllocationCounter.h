@@ -0,0 +1,68 @@
+//! \file    LogicalProcessorAllocationCounter.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor heap allocations counter.
+//!
+//! Test mode counter of the heap allocations, to check the simulation loop
+//! does not allocate once warmed up. Enabled by building with
+//! SEAPLANES_ALLOCATION_COUNTER set to 1, which replaces the global allocation
+//! operators. Allocations done inside the RTI are excluded, the callbacks to
+//! the logical processor being included again. Logs allocate their messages,
+//! the check is meant to run with a null log stream.
+
+#ifndef LOGICALPROCESSORALLOCATIONCOUNTER_H
+#define LOGICALPROCESSORALLOCATIONCOUNTER_H
+
+#ifndef SEAPLANES_ALLOCATION_COUNTER
+// SEAPLANES_ALLOCATION_COUNTER. If set to 1, count heap allocations.
+#define SEAPLANES_ALLOCATION_COUNTER 0
+#endif // SEAPLANES_ALLOCATION_COUNTER
+
+namespace Seaplanes {
+
+class AllocationCounter final {
+public:
+  AllocationCounter() = delete;
+
+  //! \brief Get if allocations are counted.
+  //! \return True if built with the counter, else false.
+  static constexpr bool isEnabled() { return (SEAPLANES_ALLOCATION_COUNTER); }
+
+  //! \brief Number of allocations counted.
+  //! \return The number of allocations so far, 0 if not enabled.
+  static unsigned long long get();
+
+  //! \brief Count an allocation, if not excluded.
+  static void count();
+
+  //! \brief Scope in which allocations of the current thread are not counted.
+  class Exclusion final {
+  public:
+    Exclusion();
+    ~Exclusion();
+    Exclusion(const Exclusion &) = delete;
+    void operator=(const Exclusion &) = delete;
+    Exclusion(Exclusion &&) = delete;
+    void operator=(Exclusion &&) = delete;
+  };
+
+  //! \brief Scope in which allocations of the current thread are counted
+  //! again, inside an exclusion.
+  class Inclusion final {
+  public:
+    Inclusion();
+    ~Inclusion();
+    Inclusion(const Inclusion &) = delete;
+    void operator=(const Inclusion &) = delete;
+    Inclusion(Inclusion &&) = delete;
+    void operator=(Inclusion &&) = delete;
+
+  private:
+    unsigned int __exclusions_; //!< Exclusions depth to restore.
+  };
+};
+
+} // namespace Seaplanes
+
+#endif // LOGICALPROCESSORALLOCATIONCOUNTER_H
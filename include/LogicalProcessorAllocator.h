@@ -0,0 +1,147 @@
+//! \file    LogicalProcessorAllocator.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Allocator of the models to the logical processors and cores.
+//!
+//! The models are allocated to at most one logical processor per core, the
+//! models of a logical processor sharing their period, so as to minimize the
+//! cost of the allocation:
+//!
+//! - the step makespan, the largest utilization of a core, the compute times
+//!   of its models plus the exchange cost of the attributes its models send
+//!   to, or receive from, the other logical processors, over its period,
+//! - plus the latency weight times the number of dependencies between
+//!   logical processors, each one delaying the data of a step.
+//!
+//! Small problems are solved exactly by branch and bound, larger ones by a
+//! greedy allocation improved by local search. The allocation is then written
+//! for the logical processors by the seaplanes-allocator tool,
+//! \see LogicalProcessorAllocation.h.
+
+#ifndef LOGICALPROCESSORALLOCATOR_H
+#define LOGICALPROCESSORALLOCATOR_H
+
+#include <cstddef>
+#include <vector>
+
+#include <LogicalProcessorCommon.h>
+
+namespace Seaplanes {
+
+class Allocator final {
+public:
+  //! \brief Profile of a model.
+  struct ModelProfile {
+    Name name{};       //!< Model name.
+    double time{0.};   //!< Mean compute time, in seconds.
+    double period{0.}; //!< Period, in seconds.
+  };
+
+  //! \brief Dependency of a model on another one.
+  struct Dependency {
+    std::size_t model{0};   //!< Index of the other model.
+    unsigned int weight{0}; //!< Number of attributes exchanged.
+  };
+
+  //! \brief Allocation problem.
+  struct Problem {
+    std::vector<ModelProfile> models{}; //!< Models profiles.
+    //! Dependencies of each model, both ways.
+    std::vector<std::vector<Dependency>> dependencies{};
+    unsigned int cores{0};       //!< Number of cores.
+    double exchange_cost{20e-6}; //!< Cost of an attribute, in seconds.
+    double latency_weight{1e-3}; //!< Cost of a dependency.
+  };
+
+  //! Logical processor of the models not allocated.
+  static constexpr int unallocated = -1;
+
+  //! \brief Allocator constructor, no model allocated.
+  //! \param problem The allocation problem, outliving the allocator.
+  explicit Allocator(const Problem & /* problem */);
+
+  //! \brief Logical processor of a model getter.
+  //! \param model The model index.
+  //! \return The logical processor index, unallocated if none.
+  int getLp(std::size_t /* model */) const;
+
+  //! \brief Logical processors of the models getter.
+  //! \return The logical processor index of each model.
+  const std::vector<int> &getLps() const;
+
+  //! \brief Load of a logical processor getter.
+  //! \param lp The logical processor index.
+  //! \return The compute and exchange time of a step, in seconds.
+  double getLoad(std::size_t /* lp */) const;
+
+  //! \brief Period of a logical processor getter.
+  //! \param lp The logical processor index.
+  //! \return The period, zero if empty.
+  double getPeriod(std::size_t /* lp */) const;
+
+  //! \brief Number of models of a logical processor getter.
+  //! \param lp The logical processor index.
+  //! \return The number of models.
+  std::size_t getSize(std::size_t /* lp */) const;
+
+  //! \brief Number of dependencies between logical processors getter.
+  //! \return The number of attributes exchanged between them.
+  unsigned long long getCut() const;
+
+  //! \brief Largest utilization getter.
+  //! \return The largest load over period of the logical processors.
+  double getMakespan() const;
+
+  //! \brief Cost getter.
+  //! \return The makespan plus the weighted dependencies.
+  double getCost() const;
+
+  //! \brief Check if a model can join a logical processor.
+  //! \param model The model index, not allocated.
+  //! \param lp The logical processor index.
+  //! \return True if the logical processor is empty or of the same period.
+  bool accepts(std::size_t /* model */, std::size_t /* lp */) const;
+
+  //! \brief Allocate a model.
+  //! \param model The model index, not allocated.
+  //! \param lp The logical processor index.
+  void allocate(std::size_t /* model */, int /* lp */);
+
+  //! \brief Release an allocated model.
+  //! \param model The model index.
+  void release(std::size_t /* model */);
+
+  //! \brief Greedy allocation of the models, none being allocated, each
+  //! model, heaviest first, joining the logical processor of least cost. A
+  //! logical processor is kept for each period.
+  //! \throw std::runtime_error If the models periods need more cores.
+  void allocateGreedy();
+
+  //! \brief Improve the allocation of all the models by moving and swapping
+  //! models while the cost decreases.
+  void improveLocally();
+
+  //! \brief Exact allocation of the models, by branch and bound, all of them
+  //! being allocated, their current allocation being the bound.
+  //! \return True if proven optimal, false if the search was cut short.
+  bool allocateExactly();
+
+private:
+  const Problem &__problem_;         //!< Allocation problem.
+  std::vector<int> __lps_;           //!< Logical processor of each model.
+  std::vector<double> __loads_;      //!< Load of each logical processor.
+  std::vector<double> __periods_;    //!< Period of each logical processor.
+  std::vector<std::size_t> __sizes_; //!< Number of models of each one.
+  unsigned long long __cut_; //!< Attributes between logical processors.
+
+  //! \brief Account the exchanges of a model with the allocated models of
+  //! the other logical processors.
+  //! \param model The model index, allocated.
+  //! \param sign 1 to add the exchanges, -1 to remove them.
+  void exchange(std::size_t /* model */, double /* sign */);
+};
+
+} // namespace Seaplanes
+
+#endif // LOGICALPROCESSORALLOCATOR_H
@@ -13,12 +13,20 @@
 #include <string>
 
 #include <LogicalProcessorCommon.h>
+#include <SeaplanesTime.h>
 
 namespace Seaplanes {
 
 //! \brief Type for attribute shared pointer.
 using SpAttribute = std::shared_ptr<class Attribute>;
 
+//! \brief Transport of the updates of attributes.
+enum class Transport {
+  DEFAULT,    //!< Transport of the object class, reliable for object classes.
+  RELIABLE,   //!< Reliable transport.
+  BEST_EFFORT //!< Best effort transport, for loss tolerant values.
+};
+
 //! \brief No fresh value error.
 //!
 //! When fresh value is asked from attribute, and there is none, this exception
@@ -29,6 +37,39 @@ class AttributeNoFreshValue final : public std::exception {};
 //! \brief Attribute class
 class Attribute final {
 public:
+  //! \brief Attribute value, which can have different representations.
+  union Value {
+    int i;
+    double d;
+    bool b;
+  };
+
+  //! \brief Attribute state, value, freshness, time stamp and age, for state
+  //! saving.
+  struct State {
+    Value value;            //!< Attribute value.
+    bool fresh;             //!< True if value is fresh, else false.
+    SeaplanesTime time;     //!< Time stamp of the received value.
+    unsigned long long age; //!< Number of steps since received.
+  };
+
+  //! \brief Attribute value read, with its freshness and age.
+  template <typename T> struct Sample {
+    T value;                //!< Attribute value.
+    bool fresh;             //!< True if not read since received, else false.
+    SeaplanesTime time;     //!< Time stamp of the reflection of the value.
+    unsigned long long age; //!< Number of steps since received.
+  };
+
+  //! \brief Attribute staleness statistics, for received attributes.
+  struct Staleness {
+    unsigned long long updates;     //!< Number of values received.
+    unsigned long long reads;       //!< Number of samples read.
+    unsigned long long stale_reads; //!< Number of samples read not fresh.
+    unsigned long long ages_sum;    //!< Sum of the ages of the samples read.
+    unsigned long long max_age;     //!< Maximum age of the samples read.
+  };
+
   //! \brief Attribute factory builder.
   //! \param  name The name of the attribute.
   //! \return The attribute in a shared pointer.
@@ -62,6 +103,32 @@ public:
   //! \return The value.
   template <typename T> T getFreshValue() const noexcept(false);
 
+  //! \brief Sample getter, without throwing if the value is not fresh. The
+  //! value is no longer fresh afterwards.
+  //! \return The value, its freshness, time stamp and age.
+  template <typename T> Sample<T> getSample() const noexcept;
+
+  //! \brief Set the value as received, when reflected.
+  //! \param time The time stamp of the reflection.
+  void setReceived(SeaplanesTime /* time */);
+
+  //! \brief Age the value of a step, for received attributes.
+  void incrementAge();
+
+  //! \brief Staleness statistics getter.
+  //! \return The staleness statistics.
+  const Staleness &getStaleness() const;
+
+  //! \brief Account for the samples read from another attribute, a model
+  //! port bound to this one.
+  //! \param staleness The staleness statistics of the reads.
+  void addReads(const Staleness & /* staleness */);
+
+  //! \brief Version getter, counting the values set and received, not the
+  //! states restored.
+  //! \return The version of the value.
+  unsigned long long getVersion() const;
+
   //! \brief Attribute handle setter.
   //! \param  attributeHandle The attribute handle
   void setHandle(RTI::AttributeHandle /*attributeHandle*/);
@@ -77,16 +144,39 @@ public:
   //! \return The attribute handle.
   RTI::AttributeHandle getHandle() const;
 
+  //! \brief Attribute state getter.
+  //! \return The attribute value, freshness, time stamp and age.
+  State getState() const;
+
+  //! \brief Attribute state setter, when restoring a saved state.
+  //! \param state The attribute value, freshness, time stamp and age.
+  void setState(const State & /* state */);
+
+  //! \brief Transport hint setter, followed by the published object instances
+  //! registered afterwards.
+  //! \param transport The transport of the updates of the attribute.
+  void setTransport(Transport /* transport */);
+
+  //! \brief Transport hint getter.
+  //! \return The transport of the updates of the attribute.
+  Transport getTransport() const;
+
 private:
   Name __name_;                   //!< Attribute name.
   RTI::AttributeHandle __handle_; //!< Attribute handle, generated during
                                   //!< attribute initialization
   mutable bool __fresh_;          //!< True if value asked is fresh, else false.
-  union {
-    int i;
-    double d;
-    bool b;
-  } __value_; //!< Attribute value, which can have different representations.
+  Value __value_;                 //!< Attribute value, which can have
+                                  //!< different representations.
+  SeaplanesTime __time_;          //!< Time stamp of the received value.
+  unsigned long long __age_;      //!< Number of steps since received.
+  unsigned long long __version_;  //!< Number of values set and received.
+  mutable Staleness __staleness_; //!< Staleness statistics.
+  Transport __transport_;         //!< Transport hint of the updates.
+
+  //! \brief Account for a sample read, and consume the freshness.
+  //! \return True if the value was fresh, else false.
+  bool sampleRead() const;
 
   //! \brief Attribute constructor.
   //! \param  name The name of the attribute.
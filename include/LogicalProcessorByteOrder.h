@@ -0,0 +1,62 @@
+//! \file    LogicalProcessorByteOrder.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor attribute values byte order.
+//!
+//! Attribute values are sent in network byte order (big endian), so
+//! federates running on hosts of different endianness can be mixed. Values of
+//! an update are encoded and decoded in bulk, byte-swapping them with SSE or
+//! AVX2 kernels when available on little endian hosts, with a scalar
+//! fallback. The fastest kernel is used, another one can be chosen to compare
+//! them.
+
+#ifndef LOGICALPROCESSORBYTEORDER_H
+#define LOGICALPROCESSORBYTEORDER_H
+
+#include <cstddef>
+#include <vector>
+
+#include <LogicalProcessorCommon.h>
+
+namespace Seaplanes {
+
+class ByteOrder final {
+public:
+  ByteOrder() = delete;
+
+  //! Size of an encoded value, in bytes.
+  static constexpr std::size_t value_size = sizeof(double);
+
+  //! \brief Encode values in network byte order.
+  //! \param p_values The values.
+  //! \param p_bytes The encoded values, count * value_size bytes.
+  //! \param count The number of values.
+  static void encode(const double * /* p_values */,
+                     unsigned char * /* p_bytes */, std::size_t /* count */);
+
+  //! \brief Decode values from network byte order.
+  //! \param p_bytes The encoded values, count * value_size bytes.
+  //! \param p_values The values.
+  //! \param count The number of values.
+  static void decode(const unsigned char * /* p_bytes */,
+                     double * /* p_values */, std::size_t /* count */);
+
+  //! \brief Name of the kernel used, for logs.
+  //! \return The kernel name.
+  static Name getKernel();
+
+  //! \brief Names of the kernels supported by the host.
+  //! \return The kernel names, the fastest first.
+  static std::vector<Name> getKernels();
+
+  //! \brief Choose the kernel used, instead of the fastest one. To be called
+  //! before the values are encoded or decoded by other threads.
+  //! \param name The kernel name.
+  //! \throw std::invalid_argument If the kernel is not supported by the host.
+  static void setKernel(const Name & /* name */);
+};
+
+} // namespace Seaplanes
+
+#endif // LOGICALPROCESSORBYTEORDER_H
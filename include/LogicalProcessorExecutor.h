@@ -0,0 +1,142 @@
+//! \file    LogicalProcessorExecutor.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor parallel models execution.
+//!
+//! This class runs the models of a step on a pool of threads, the calling
+//! thread included. A model is run once the models it depends on are, so
+//! independent models run in parallel. Each thread runs the models it made
+//! ready first, and steals from the other threads when it has none. The
+//! delayed inputs are snapshot before the models run, so a model reading one
+//! never races with the model writing it. In deterministic mode, a model
+//! reading a delayed input is also ordered with the model writing it, as in
+//! the sequential execution, for the models sharing state out of their ports.
+
+#ifndef LOGICALPROCESSOREXECUTOR_H
+#define LOGICALPROCESSOREXECUTOR_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <LogicalProcessorModelScheduler.h>
+
+namespace Seaplanes {
+
+//! \brief Type for executor unique pointer.
+using UpExecutor = std::unique_ptr<class Executor>;
+
+class Executor final {
+public:
+  //! \brief Create an executor, and start its threads.
+  //! \param threads_number The number of threads, the calling thread included,
+  //! 0 for the number of hardware threads.
+  //! \param deterministic True for results not depending on the number of
+  //! threads.
+  //! \return The new executor.
+  static UpExecutor create(unsigned int /* threads_number */,
+                           bool /* deterministic */);
+
+  //! \brief Executor destructor, stops its threads.
+  ~Executor();
+  Executor(const Executor &) = delete;
+  void operator=(const Executor &) = delete;
+  Executor(Executor &&) = delete;
+  void operator=(Executor &&) = delete;
+
+  //! \brief Build the tasks graph of ordered models.
+  //! \param scheduler The scheduler, once the models ordered.
+  void setup(const ModelScheduler & /* scheduler */);
+
+  //! \brief Snapshot the delayed inputs, run the models of a step, and wait
+  //! for them.
+  //! \throw The first exception thrown by a model, once the step is done.
+  void run();
+
+  //! \brief Number of threads getter.
+  //! \return The number of threads, the calling thread included.
+  std::size_t getThreadsNumber() const;
+
+private:
+  //! \brief Ready models of a thread, one push at most per model and step.
+  struct Worker {
+    std::mutex mutex;               //!< Protects the tasks.
+    std::vector<std::size_t> tasks; //!< Ready models indexes.
+    std::size_t head;               //!< Index of the oldest task, stolen.
+    std::size_t tail;               //!< Index after the newest task, run.
+  };
+
+  bool __deterministic_; //!< True to order delayed inputs.
+
+  VecSpModel __sp_models_; //!< Models, in declaration order.
+
+  //! Successors of each model.
+  std::vector<std::vector<std::size_t>> __successors_;
+
+  //! Number of predecessors of each model.
+  std::vector<std::size_t> __predecessors_numbers_;
+
+  //! Models without predecessors, in execution order.
+  std::vector<std::size_t> __roots_;
+
+  //! Number of predecessors of each model not run yet during the step.
+  std::unique_ptr<std::atomic<std::size_t>[]> __pending_;
+
+  std::atomic<std::size_t> __remaining_; //!< Models not run yet.
+
+  std::vector<std::unique_ptr<Worker>> __workers_; //!< Threads tasks.
+
+  std::mutex __mutex_;              //!< Protects the state below.
+  std::condition_variable __cv_;    //!< Wakes the threads on steps.
+  bool __running_;                  //!< False to stop the threads.
+  unsigned long long __generation_; //!< Step counter, to wake the threads.
+  std::exception_ptr __exception_;  //!< First exception of the step.
+
+  std::vector<std::thread> __threads_; //!< Threads, the calling one excluded.
+
+  //! \brief Thread loop.
+  //! \param worker The thread index.
+  void wait(std::size_t /* worker */);
+
+  //! \brief Run models until the step is done.
+  //! \param worker The thread index.
+  void work(std::size_t /* worker */);
+
+  //! \brief Take the newest task of the thread.
+  //! \param worker The thread index.
+  //! \param[out] model The model index.
+  //! \return True if a task was taken, else false.
+  bool pop(std::size_t /* worker */, std::size_t & /* model */);
+
+  //! \brief Take the oldest task of another thread.
+  //! \param worker The thread index.
+  //! \param[out] model The model index.
+  //! \return True if a task was taken, else false.
+  bool steal(std::size_t /* worker */, std::size_t & /* model */);
+
+  //! \brief Add a task to a thread.
+  //! \param worker The thread index.
+  //! \param model The model index.
+  void push(std::size_t /* worker */, std::size_t /* model */);
+
+  //! \brief Run a model and release its successors.
+  //! \param worker The thread index.
+  //! \param model The model index.
+  void execute(std::size_t /* worker */, std::size_t /* model */);
+
+  //! \brief Executor constructor, private to use the factory builder.
+  //! \param threads_number The number of threads, the calling thread included.
+  //! \param deterministic True for results not depending on the number of
+  //! threads.
+  Executor(unsigned int /* threads_number */, bool /* deterministic */);
+};
+
+} // namespace Seaplanes
+
+#endif // LOGICALPROCESSOREXECUTOR_H
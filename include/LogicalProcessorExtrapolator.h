@@ -0,0 +1,72 @@
+//! \file    LogicalProcessorExtrapolator.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor attribute values extrapolation.
+//!
+//! This class extrapolates an attribute from its last time stamped values, by
+//! a zero, first or second order hold. The same extrapolation is used by the
+//! subscribers between two updates, and by the publisher, for dead reckoning:
+//! an update is only sent when the extrapolation of the subscribers would be
+//! too far from the actual value.
+
+#ifndef LOGICALPROCESSOREXTRAPOLATOR_H
+#define LOGICALPROCESSOREXTRAPOLATOR_H
+
+#include <array>
+#include <cstddef>
+
+#include <SeaplanesTime.h>
+
+namespace Seaplanes {
+
+class Extrapolator final {
+public:
+  //! \brief Extrapolation order.
+  enum class Order : unsigned int {
+    ZERO,   //!< Last value held.
+    FIRST,  //!< Linear, from the last two values.
+    SECOND, //!< Quadratic, from the last three values.
+  };
+
+  //! \brief Extrapolator constructor.
+  //! \param order The extrapolation order.
+  explicit Extrapolator(Order /* order */ = Order::ZERO);
+
+  //! \brief Order getter.
+  //! \return The extrapolation order.
+  Order getOrder() const;
+
+  //! \brief Add a value, newer than the previous ones.
+  //! \param time The time stamp of the value.
+  //! \param value The value.
+  void addSample(SeaplanesTime /* time */, double /* value */);
+
+  //! \brief Get if a value was added.
+  //! \return True if no value was added, else false.
+  bool empty() const;
+
+  //! \brief Extrapolate the value. With less values than needed by the order,
+  //! the order is lowered.
+  //! \param time The time to extrapolate the value at.
+  //! \return The extrapolated value, 0 if empty.
+  double extrapolate(SeaplanesTime /* time */) const;
+
+private:
+  //! Number of values kept.
+  static constexpr std::size_t samples_capacity = 3;
+
+  Order __order_; //!< Extrapolation order.
+
+  //! Time stamps of the last values in seconds, newest first.
+  std::array<double, samples_capacity> __times_;
+
+  //! Last values, newest first.
+  std::array<double, samples_capacity> __values_;
+
+  std::size_t __samples_number_; //!< Number of values kept.
+};
+
+} // namespace Seaplanes
+
+#endif // LOGICALPROCESSOREXTRAPOLATOR_H
@@ -0,0 +1,80 @@
+//! \file    LogicalProcessorFomClass.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor typed object instances, from generated FOM
+//! classes.
+//!
+//! The FOM classes are generated from the federation file by the
+//! seaplanes-fom-generator tool, as structs holding the attributes values,
+//! with constexpr attributes indexes in the FOM order. The object instances
+//! created here belong to an object class added to the logical processor, and
+//! have their attributes added in this order, so the values are read and
+//! written by index, without name lookups, in the store of the instance if
+//! bound to one. A store created from the class attributes names has its
+//! columns at the same indexes. The values are then updated and reflected as
+//! the ones of any object instance, through its update policies.
+//!
+//! A generated FOM class C provides:
+//! - static constexpr const char *getClassName(), the object class name;
+//! - static constexpr std::size_t attributes_number;
+//! - static std::vector<Name> getAttributesNames(), in the indexes order;
+//! - std::array<double, attributes_number> values, by index.
+
+#ifndef LOGICALPROCESSORFOMCLASS_H
+#define LOGICALPROCESSORFOMCLASS_H
+
+#include <stdexcept>
+
+#include <LogicalProcessorObjectInstancePublished.h>
+#include <LogicalProcessorObjectInstanceSubscribed.h>
+
+namespace Seaplanes {
+
+//! \brief Check that an object class is the one of a FOM class.
+//! \template class C The generated FOM class.
+//! \param sp_object The object class.
+//! \throw std::invalid_argument If the object class is another one.
+template <class C> void checkFomClass(const SpObject & /* sp_object */);
+
+//! \brief Create a published object instance of a FOM class.
+//! \template class C The generated FOM class.
+//! \param name The name of the object instance.
+//! \param sp_object The object class of the FOM class, added to the logical
+//! processor for its handle to be set.
+//! \return The published object instance in unique pointer.
+//! \throw std::invalid_argument If the object class is another one.
+template <class C>
+UpObjectInstancePublished createFomPublished(Name /* name */,
+                                             SpObject /* sp_object */);
+
+//! \brief Create a subscribed object instance of a FOM class.
+//! \template class C The generated FOM class.
+//! \param name The name of the object instance.
+//! \param sp_object The object class of the FOM class, added to the logical
+//! processor for its handle to be set.
+//! \return The subscribed object instance in unique pointer.
+//! \throw std::invalid_argument If the object class is another one.
+template <class C>
+UpObjectInstanceSubscribed createFomSubscribed(Name /* name */,
+                                               SpObject /* sp_object */);
+
+//! \brief Read the attributes values of an object instance of a FOM class.
+//! \template class C The generated FOM class.
+//! \param instance The object instance, created for the FOM class.
+//! \param[out] values The values.
+template <class C>
+void readFomValues(const ObjectInstance & /* instance */, C & /* values */);
+
+//! \brief Write the attributes values of an object instance of a FOM class.
+//! \template class C The generated FOM class.
+//! \param instance The object instance, created for the FOM class.
+//! \param values The values.
+template <class C>
+void writeFomValues(ObjectInstance & /* instance */, const C & /* values */);
+
+#include <LogicalProcessorFomClass.tcc>
+
+} // namespace Seaplanes
+
+#endif // LOGICALPROCESSORFOMCLASS_H
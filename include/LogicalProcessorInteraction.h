@@ -0,0 +1,98 @@
+//! \file    LogicalProcessorInteraction.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor interaction, sent or received.
+//!
+//! An interaction is an event of an interaction class, commands, failures or
+//! mode switches, with a typed value per parameter of its class. Values are
+//! sent as doubles, in network byte order, as the attributes values.
+
+#ifndef LOGICALPROCESSORINTERACTION_H
+#define LOGICALPROCESSORINTERACTION_H
+
+#include <type_traits>
+#include <vector>
+
+#include <LogicalProcessorCommon.h>
+#include <LogicalProcessorInteractionClass.h>
+#include <SeaplanesTime.h>
+
+namespace Seaplanes {
+
+class Interaction final {
+public:
+  //! \brief Interaction constructor, parameters set to zero.
+  //! \param sp_interaction_class The class of the interaction, with all its
+  //! parameters added.
+  explicit Interaction(SpInteractionClass /* sp_interaction_class */);
+
+  //! \brief Interaction class getter.
+  //! \return The class of the interaction.
+  const SpInteractionClass &getInteractionClass() const;
+
+  //! \brief Interaction class setter, parameters set to zero, reusing the
+  //! storage of the values.
+  //! \param sp_interaction_class The class of the interaction.
+  void setInteractionClass(SpInteractionClass /* sp_interaction_class */);
+
+  //! \brief Parameter setter.
+  //! \param index The index of the parameter in the interaction class.
+  //! \param value The value of the parameter.
+  template <typename T>
+  void setParameter(std::size_t /* index */, T /* value */);
+
+  //! \brief Parameter setter, by name.
+  //! \param name The name of the parameter in the interaction class.
+  //! \param value The value of the parameter.
+  //! \throw std::invalid_argument If the class has no such parameter.
+  template <typename T>
+  void setParameter(const Name & /* name */, T /* value */);
+
+  //! \brief Parameter getter.
+  //! \param index The index of the parameter in the interaction class.
+  //! \return The value of the parameter.
+  template <typename T> T getParameter(std::size_t /* index */) const;
+
+  //! \brief Parameter getter, by name.
+  //! \param name The name of the parameter in the interaction class.
+  //! \return The value of the parameter.
+  //! \throw std::invalid_argument If the class has no such parameter.
+  template <typename T> T getParameter(const Name & /* name */) const;
+
+  //! \brief Time stamp getter.
+  //! \return The time stamp of a received interaction, the time of the last
+  //! grant if received in receive order.
+  SeaplanesTime getTime() const;
+
+  //! \brief Time stamp setter, when received.
+  //! \param time The time stamp.
+  void setTime(SeaplanesTime /* time */);
+
+  //! \brief Encode the parameters to send.
+  //! \param parameters The parameters set, emptied then filled.
+  //! \param encoded The buffer of the encoded values, at least a value per
+  //! parameter.
+  void encodeParameters(RTI::ParameterHandleValuePairSet & /* parameters */,
+                        std::vector<unsigned char> & /* encoded */) const;
+
+  //! \brief Decode the parameters received, the unknown ones being ignored and
+  //! the missing ones set to zero.
+  //! \param parameters The parameters set received.
+  void
+  decodeParameters(const RTI::ParameterHandleValuePairSet & /* parameters */);
+
+private:
+  SpInteractionClass __sp_interaction_class_; //!< Class of the interaction.
+  std::vector<double> __values_;              //!< Values, by parameter index.
+  SeaplanesTime __time_;                      //!< Time stamp, when received.
+};
+
+//! \brief Type for vector of interactions.
+using VecInteraction = std::vector<Interaction>;
+
+#include <LogicalProcessorInteraction.tcc>
+
+} // namespace Seaplanes
+
+#endif // LOGICALPROCESSORINTERACTION_H
@@ -0,0 +1,112 @@
+//! \file    LogicalProcessorInteractionClass.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor interaction class manipulation.
+//!
+//! This class provides a simple way to use interaction class, mirroring the
+//! object class: an interaction class has a name, a handle, and parameters,
+//! identified by their index in the order they are added.
+
+#ifndef LOGICALPROCESSORINTERACTIONCLASS_H
+#define LOGICALPROCESSORINTERACTIONCLASS_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <LogicalProcessorCommon.h>
+
+namespace Seaplanes {
+
+//! \brief Type for interaction class shared pointer.
+using SpInteractionClass = std::shared_ptr<class InteractionClass>;
+
+class InteractionClass final {
+public:
+  //! \brief Index of no parameter.
+  static constexpr std::size_t no_parameter = static_cast<std::size_t>(-1);
+
+  //! \brief Interaction class factory builder.
+  //! \param name The name of the interaction class.
+  //! \return The interaction class in a shared pointer.
+  static SpInteractionClass create(Name /* name */);
+
+  //! \brief Interaction class name getter.
+  //! \return The name of the interaction class.
+  Name getName() const;
+
+  //! \brief Add a parameter, before fetching the handles.
+  //! \param name The name of the parameter.
+  //! \return The index of the parameter.
+  std::size_t addParameter(Name /* name */);
+
+  //! \brief Number of parameters getter.
+  //! \return The number of parameters.
+  std::size_t getParametersNumber() const;
+
+  //! \brief Get the index of a parameter from its name.
+  //! \param name The name of the parameter.
+  //! \return The index of the parameter.
+  //! \throw std::invalid_argument If the interaction class has no such
+  //! parameter.
+  std::size_t getParameterIndex(const Name & /* name */) const;
+
+  //! \brief Get the index of a parameter from its handle.
+  //! \param handle The handle of the parameter.
+  //! \return The index of the parameter, no_parameter if unknown.
+  std::size_t findParameterIndex(RTI::ParameterHandle /* handle */) const;
+
+  //! \brief Parameter handle getter.
+  //! \param index The index of the parameter.
+  //! \return The handle of the parameter.
+  RTI::ParameterHandle getParameterHandle(std::size_t /* index */) const;
+
+  //! \brief Parameter handle setter.
+  //! \param index The index of the parameter.
+  //! \param handle The handle of the parameter.
+  void setParameterHandle(std::size_t /* index */,
+                          RTI::ParameterHandle /* handle */);
+
+  //! \brief Interaction class and parameters handles setter, handles are
+  //! generated from RTIA.
+  //! \param p_rtia A pointer to the RTIA.
+  void setHandles(RTI::RTIambassador * /* p_rtia */);
+
+  //! \brief Interaction class handle getter.
+  //! \return The interaction class handle.
+  RTI::InteractionClassHandle getHandle() const;
+
+  //! \brief Publish the interaction class.
+  //! \param p_rtia A pointer to the RTIA.
+  void publish(RTI::RTIambassador * /* p_rtia */);
+
+  //! \brief Unpublish the interaction class.
+  //! \param p_rtia A pointer to the RTIA.
+  void unpublish(RTI::RTIambassador * /* p_rtia */);
+
+  //! \brief Subscribe to the interaction class.
+  //! \param p_rtia A pointer to the RTIA.
+  void subscribe(RTI::RTIambassador * /* p_rtia */);
+
+  //! \brief Unsubscribe from the interaction class.
+  //! \param p_rtia A pointer to the RTIA.
+  void unsubscribe(RTI::RTIambassador * /* p_rtia */);
+
+private:
+  RTI::InteractionClassHandle __handle_; //!< Interaction class handle.
+  Name __name_;                          //!< Interaction class name.
+
+  std::vector<Name> __parameters_names_; //!< Parameters names, by index.
+
+  //! Parameters handles, by index.
+  std::vector<RTI::ParameterHandle> __parameters_handles_;
+
+  //! \brief Interaction class constructor.
+  //! \param name The name of the interaction class.
+  explicit InteractionClass(Name /* name */);
+};
+
+} // namespace Seaplanes
+
+#endif // LOGICALPROCESSORINTERACTIONCLASS_H
@@ -0,0 +1,108 @@
+//! \file    LogicalProcessorIoThread.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor RTI input/output thread.
+//!
+//! This class runs a thread ticking the RTI during the simulation loop, so the
+//! communications overlap the local calculation. The reflections received are
+//! decoded by this thread into the back buffers of the subscribed object
+//! instances, swapped by the simulation thread at the updates reception. Time
+//! advance grants are notified to the simulation thread, which spins shortly
+//! before sleeping.
+//!
+//! The back buffers are the lock-free handoff between the two threads, in
+//! place of a queue of decoded reflections: the models only read the last
+//! value of each attribute at a step, so a queue would hold values overwritten
+//! before being read, bounded by the number of reflections rather than of
+//! attributes, and stalling the RTI when full until the simulation thread
+//! drains it. A back buffer is written in place, swapped with a compare and
+//! swap, and never full. Interactions, events not to be merged, are queued and
+//! swapped under the RTI lock, taken anyway by the simulation thread.
+//!
+//! The RTI ambassador is not thread safe: the simulation thread locks it to
+//! send updates and request time advances, the thread then pausing between two
+//! ticks. Callbacks other than reflections and grants run on this thread, while
+//! the RTI is locked.
+
+#ifndef LOGICALPROCESSORIOTHREAD_H
+#define LOGICALPROCESSORIOTHREAD_H
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <LogicalProcessorCommon.h>
+
+namespace Seaplanes {
+
+//! \brief Type for I/O thread unique pointer.
+using UpIoThread = std::unique_ptr<class IoThread>;
+
+class IoThread final {
+public:
+  //! \brief Scope in which the simulation thread uses the RTI. No-op for a
+  //! null I/O thread.
+  class Lock final {
+  public:
+    //! \brief Lock the RTI.
+    //! \param p_io_thread A pointer to the I/O thread, may be null.
+    explicit Lock(IoThread * /* p_io_thread */);
+    ~Lock();
+    Lock(const Lock &) = delete;
+    void operator=(const Lock &) = delete;
+    Lock(Lock &&) = delete;
+    void operator=(Lock &&) = delete;
+
+  private:
+    IoThread *__p_io_thread_; //!< The I/O thread, may be null.
+  };
+
+  //! \brief Create an I/O thread, and start it.
+  //! \param rti_amb The RTI ambassador to tick.
+  //! \param tick_time The time waited for messages by a tick, in seconds.
+  //! \return The new I/O thread.
+  static UpIoThread create(RTI::RTIambassador & /* rti_amb */,
+                           double /* tick_time */);
+
+  //! \brief I/O thread destructor, stops the thread.
+  ~IoThread();
+  IoThread(const IoThread &) = delete;
+  void operator=(const IoThread &) = delete;
+  IoThread(IoThread &&) = delete;
+  void operator=(IoThread &&) = delete;
+
+  //! \brief Notify a time advance grant, from the I/O thread.
+  void notifyGrant();
+
+  //! \brief Wait for a time advance grant, from the simulation thread.
+  void waitGrant();
+
+private:
+  RTI::RTIambassador &__rti_amb_; //!< The RTI ambassador.
+  double __tick_time_;            //!< Time waited for messages by a tick.
+
+  std::mutex __rti_mutex_;         //!< Locks the RTI ambassador.
+  std::atomic<bool> __rti_wanted_; //!< True if the simulation thread waits.
+  std::atomic<bool> __running_;    //!< False to stop the thread.
+  std::atomic<bool> __granted_;    //!< True once a grant is received.
+
+  std::mutex __notification_mutex_;       //!< Protects the sleeps.
+  std::condition_variable __notification_; //!< Wakes the simulation thread.
+
+  std::thread __thread_; //!< I/O thread.
+
+  //! \brief I/O thread loop.
+  void tick();
+
+  //! \brief I/O thread constructor, private to use the factory builder.
+  //! \param rti_amb The RTI ambassador to tick.
+  //! \param tick_time The time waited for messages by a tick, in seconds.
+  IoThread(RTI::RTIambassador & /* rti_amb */, double /* tick_time */);
+};
+
+} // namespace Seaplanes
+
+#endif // LOGICALPROCESSORIOTHREAD_H
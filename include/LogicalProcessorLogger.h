@@ -42,6 +42,21 @@ public:
   void log(Level /* level */, const Message & /* message */);
   void operator<<(const Message & /* message */);
 
+  //! \brief Log a literal message at the default level, without building a
+  //! message when not logging.
+  //! \param message The message.
+  void operator<<(const char * /* message */);
+
+  //! \brief Get if messages of a level are logged, to avoid building messages
+  //! for nothing in the simulation loop.
+  //! \param level The level.
+  //! \return True if logged, else false.
+  bool isLogging(Level /* level */) const;
+
+  //! \brief Get if messages of the default level are logged.
+  //! \return True if logged, else false.
+  bool isLogging() const;
+
 private:
   std::ostream *__p_log_stream_;
   static Level __default_level_;
@@ -0,0 +1,140 @@
+//! \file    LogicalProcessorMetrics.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor live metrics, in shared memory.
+//!
+//! This class exposes the metrics of a logical processor in a POSIX shared
+//! memory segment, named after the federate and its process, so tools can
+//! read all the federates of a host live. The segment is versioned, and
+//! written at each step under a sequence lock: readers copy it and retry if
+//! it changed meanwhile, without ever blocking the logical processor.
+
+#ifndef LOGICALPROCESSORMETRICS_H
+#define LOGICALPROCESSORMETRICS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace Seaplanes {
+
+//! \brief Type for metrics unique pointer.
+using UpMetrics = std::unique_ptr<class Metrics>;
+
+class Metrics final {
+public:
+  //! Version of the segment layout, changed with the snapshot fields.
+  static constexpr std::uint32_t version = 1;
+
+  //! Prefix of the segments names.
+  static constexpr const char *prefix = "/seaplanes.";
+
+  //! \brief Step phases timed.
+  enum class Phase : unsigned int {
+    RECEPTION,    //!< Updates reception.
+    CALCULATION,  //!< Local calculation, with its logs.
+    SENDING,      //!< Updates sending.
+    TIME_ADVANCE, //!< Time advance, grant wait included.
+  };
+
+  //! Number of step phases timed.
+  static constexpr std::size_t phases_number = 4;
+
+  //! \brief Metrics of a logical processor, as written in the segment.
+  struct Snapshot {
+    char federate_name[64];             //!< Federate name, truncated.
+    std::int64_t pid;                   //!< Federate process.
+    std::uint64_t step_number;          //!< Step index.
+    double local_time;                  //!< Local time, in seconds.
+    double time_limit;                  //!< Time limit, in seconds.
+    double steps_per_second;            //!< Steps per wall second.
+    double real_time_factor;            //!< Local time per wall time.
+    double phases_times[phases_number]; //!< Last step phases, in seconds.
+    double grant_wait_time;             //!< Last TAR to TAG wait, in seconds.
+    double max_grant_wait_time;         //!< Longest TAR to TAG wait.
+    std::uint64_t reflections_received; //!< Reflections received.
+    std::uint64_t values_received;      //!< Values received.
+    std::uint64_t bytes_received;       //!< Bytes received.
+    std::uint64_t updates_sent;         //!< Updates sent.
+    std::uint64_t values_sent;          //!< Values sent.
+    std::uint64_t bytes_sent;           //!< Bytes sent.
+  };
+
+  ~Metrics();
+  Metrics(const Metrics &) = delete;
+  void operator=(const Metrics &) = delete;
+  Metrics(Metrics &&) = delete;
+  void operator=(Metrics &&) = delete;
+
+  //! \brief Metrics factory builder, creating the segment.
+  //! \param federate_name The name of the federate.
+  //! \return The metrics in unique pointer.
+  //! \throw std::system_error If the segment cannot be created.
+  static UpMetrics create(const std::string & /* federate_name */);
+
+  //! \brief Segment name getter.
+  //! \return The name of the segment.
+  const std::string &getName() const;
+
+  //! \brief Snapshot getter, to fill before publishing.
+  //! \return The snapshot.
+  Snapshot &getSnapshot();
+
+  //! \brief Start the wall clock of the steps rates and phases.
+  void start();
+
+  //! \brief End of a step phase, timed from the end of the previous one.
+  //! \param phase The phase.
+  void mark(Phase /* phase */);
+
+  //! \brief Account for a received reflection, from any thread.
+  //! \param values The number of values.
+  //! \param bytes The number of bytes.
+  void countReceived(std::size_t /* values */, std::size_t /* bytes */);
+
+  //! \brief Account for a sent update.
+  //! \param values The number of values.
+  //! \param bytes The number of bytes.
+  void countSent(std::size_t /* values */, std::size_t /* bytes */);
+
+  //! \brief Write the snapshot to the segment, with the step rates.
+  void publish();
+
+  //! \brief Size of a segment.
+  //! \return The size of a segment, in bytes.
+  static std::size_t getSegmentSize();
+
+  //! \brief Read a mapped segment, retrying while it is written.
+  //! \param p_segment The mapped segment, of at least the segment size.
+  //! \param[out] snapshot The snapshot read.
+  //! \return True if read, false if not a segment of this version, or if
+  //! written for too long.
+  static bool read(const void * /* p_segment */, Snapshot & /* snapshot */);
+
+private:
+  //! \brief Shared memory segment layout.
+  struct Segment;
+
+  std::string __name_;   //!< Segment name.
+  Segment *__p_segment_; //!< Mapped segment.
+  Snapshot __snapshot_;  //!< Snapshot to publish.
+
+  //! Reflections, values and bytes received, possibly from an I/O thread.
+  std::atomic<std::uint64_t> __received_[3];
+
+  std::chrono::steady_clock::time_point __start_; //!< Wall clock start.
+  std::chrono::steady_clock::time_point __mark_;  //!< Last phase end.
+
+  //! \brief Metrics constructor.
+  //! \param name The name of the segment.
+  //! \param p_segment The mapped segment.
+  Metrics(std::string /* name */, Segment * /* p_segment */);
+};
+
+} // namespace Seaplanes
+
+#endif // LOGICALPROCESSORMETRICS_H
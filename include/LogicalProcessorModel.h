@@ -0,0 +1,136 @@
+//! \file    LogicalProcessorModel.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor model.
+//!
+//! A model is a part of the local calculation of a logical processor, which
+//! declares its input and output ports, bound to attributes. An attribute
+//! bound to the output of a model and to the input of another one is an edge
+//! inside the logical processor: the consumer runs after the producer and
+//! reads its output of the same step, without going through the RTI. Delayed
+//! inputs read the value of the previous step instead, to break loops: the
+//! model reads a snapshot of the attribute, taken before the models of a step
+//! run, whatever the order they run in.
+//!
+//! A model reads its own copy of each input, its port, refreshed before it
+//! computes. The freshness of a value is thus consumed per reader: models
+//! reading the same attribute, possibly at the same time, all see a new value
+//! as fresh, and never write the attribute they read.
+
+#ifndef LOGICALPROCESSORMODEL_H
+#define LOGICALPROCESSORMODEL_H
+
+#include <memory>
+#include <vector>
+
+#include <LogicalProcessorCommon.h>
+#include <LogicalProcessorObjectInstance.h>
+
+namespace Seaplanes {
+
+//! \brief Type for model shared pointer.
+using SpModel = std::shared_ptr<class Model>;
+
+//! \brief Type for vector of model shared pointers.
+using VecSpModel = std::vector<SpModel>;
+
+class Model {
+public:
+  //! \brief Default virtual destructor
+  virtual ~Model() = default;
+  Model(const Model &) = delete;
+  void operator=(const Model &) = delete;
+  Model(Model &&) = delete;
+  void operator=(Model &&) = delete;
+
+  //! \brief Model name getter.
+  //! \return The name of the model.
+  Name getName() const;
+
+  //! \brief Input ports getter.
+  //! \return The attributes bound to the input ports, delayed ones excluded.
+  const VecSpAttribute &getInputs() const;
+
+  //! \brief Delayed input ports getter.
+  //! \return The attributes bound to the delayed input ports.
+  const VecSpAttribute &getDelayedInputs() const;
+
+  //! \brief Snapshot the delayed inputs, before the models of a step run.
+  void delayedInputsSnapshotting();
+
+  //! \brief Refresh the input ports, right before the model computes.
+  void inputsReading();
+
+  //! \brief Account for the samples read from the ports in the staleness
+  //! statistics of the attributes bound to them.
+  void readsAccounting();
+
+  //! \brief Output ports getter.
+  //! \return The attributes bound to the output ports.
+  const VecSpAttribute &getOutputs() const;
+
+  //! \brief Compute a step, reading the inputs and writing the outputs.
+  virtual void compute() = 0;
+
+  //! \brief Error estimate of the step just computed, for adaptive steps.
+  //! \return The error estimate, zero by default.
+  virtual double getErrorEstimate() const;
+
+protected:
+  //! \brief Model constructor.
+  //! \param name The name of the model.
+  explicit Model(Name /* name */);
+
+  //! \brief Declare an input port.
+  //! \param sp_attribute The attribute bound to the port.
+  //! \param delayed True to read the value of the previous step, when the
+  //! producer is a model depending on this one.
+  //! \return The attribute to read: the port of the attribute bound, or the
+  //! snapshot of its value at the end of the previous step for a delayed
+  //! input.
+  SpAttribute addInput(SpAttribute /* sp_attribute */,
+                       bool /* delayed */ = false);
+
+  //! \brief Declare an output port.
+  //! \param sp_attribute The attribute bound to the port.
+  void addOutput(SpAttribute /* sp_attribute */);
+
+private:
+  Name __name_;                     //!< Model name.
+  VecSpAttribute __inputs_;         //!< Input ports.
+  VecSpAttribute __delayed_inputs_; //!< Delayed input ports.
+  VecSpAttribute __outputs_;        //!< Output ports.
+
+  //! Copies of the inputs, read by the model.
+  VecSpAttribute __input_ports_;
+
+  //! Versions of the inputs copied to the ports.
+  std::vector<unsigned long long> __inputs_versions_;
+
+  //! Snapshots of the delayed inputs, read by the model.
+  VecSpAttribute __delayed_snapshots_;
+
+  //! Versions of the delayed inputs copied to the snapshots.
+  std::vector<unsigned long long> __delayed_versions_;
+
+  //! \brief Copy the state of an attribute to the copy read by the model,
+  //! fresh if the attribute changed since the last copy or if the copy was
+  //! not read since.
+  //! \param attribute The attribute bound to the port.
+  //! \param port The copy read by the model.
+  //! \param version The version of the last copy, updated.
+  static void reading(const Attribute & /* attribute */, Attribute & /* port */,
+                      unsigned long long & /* version */);
+
+  //! \brief Create the copy of an attribute read by the model.
+  //! \param attribute The attribute bound to the port.
+  //! \param[out] version The version of the copy.
+  //! \return The copy.
+  static SpAttribute port(const Attribute & /* attribute */,
+                          unsigned long long & /* version */);
+};
+
+} // namespace Seaplanes
+
+#endif // LOGICALPROCESSORMODEL_H
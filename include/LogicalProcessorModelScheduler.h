@@ -0,0 +1,121 @@
+//! \file    LogicalProcessorModelScheduler.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor models scheduling.
+//!
+//! This class builds the dataflow graph of the models of a logical processor,
+//! from the attributes bound to their ports, and runs them in a topological
+//! order at each step. Models without dependencies between them keep their
+//! declaration order. A delayed input does not order its reader after the
+//! model writing it, the reader reading a snapshot of the previous step, taken
+//! before the models run. The scheduler also records, for each delayed input,
+//! which of the reader and the writer comes first in the execution order, for
+//! a parallel execution to keep that order.
+
+#ifndef LOGICALPROCESSORMODELSCHEDULER_H
+#define LOGICALPROCESSORMODELSCHEDULER_H
+
+#include <cstddef>
+#include <vector>
+
+#include <LogicalProcessorModel.h>
+
+namespace Seaplanes {
+
+class ModelScheduler final {
+public:
+  ModelScheduler();
+
+  //! \brief Add a model.
+  //! \param sp_model The model.
+  void addModel(SpModel /* sp_model */);
+
+  //! \brief Models getter, in declaration order.
+  //! \return The models.
+  const VecSpModel &getModels() const;
+
+  //! \brief Build the dataflow graph and order the models.
+  //! \throw std::logic_error if an attribute is the output of several models,
+  //! or if models depend on each other without delayed input.
+  void order();
+
+  //! \brief Ordered models getter.
+  //! \return The models indexes, in execution order.
+  const std::vector<std::size_t> &getOrder() const;
+
+  //! \brief Models depending on a model getter.
+  //! \param model The model index.
+  //! \return The indexes of the models reading outputs of the model.
+  const std::vector<std::size_t> &getSuccessors(std::size_t /* model */) const;
+
+  //! \brief Number of models a model depends on.
+  //! \param model The model index.
+  //! \return The number of models the model reads outputs of.
+  std::size_t getPredecessorsNumber(std::size_t /* model */) const;
+
+  //! \brief Models to run after a model, for delayed inputs, getter.
+  //! \param model The model index.
+  //! \return The indexes of the models that come after the model in the
+  //! execution order, and read a delayed input it writes or write a delayed
+  //! input it reads.
+  const std::vector<std::size_t> &
+  getDelayedSuccessors(std::size_t /* model */) const;
+
+  //! \brief Number of models to run before a model, for delayed inputs.
+  //! \param model The model index.
+  //! \return The number of models that come before the model in the execution
+  //! order, and read a delayed input it writes or write a delayed input it
+  //! reads.
+  std::size_t getDelayedPredecessorsNumber(std::size_t /* model */) const;
+
+  //! \brief Snapshot the delayed inputs, then run the models of a step, in
+  //! order.
+  void run();
+
+  //! \brief Measure the compute time of each model, when run in order.
+  void enableProfiling();
+
+  //! \brief Mean compute time of a model getter.
+  //! \param model The model index.
+  //! \return The mean compute time in seconds, zero if not profiled.
+  double getMeanComputeTime(std::size_t /* model */) const;
+
+private:
+  VecSpModel __sp_models_; //!< Models, in declaration order.
+
+  std::vector<std::size_t> __order_; //!< Execution order.
+
+  //! Successors of each model.
+  std::vector<std::vector<std::size_t>> __successors_;
+
+  //! Number of predecessors of each model.
+  std::vector<std::size_t> __predecessors_numbers_;
+
+  //! Successors of each model, for delayed inputs.
+  std::vector<std::vector<std::size_t>> __delayed_successors_;
+
+  //! Number of predecessors of each model, for delayed inputs.
+  std::vector<std::size_t> __delayed_predecessors_numbers_;
+
+  bool __profiling_; //!< True if the compute times are measured.
+
+  //! Compute times of each model, summed over the runs, in seconds.
+  std::vector<double> __compute_times_;
+
+  unsigned long long __runs_number_; //!< Number of profiled runs.
+
+  //! \brief Add an edge to a graph, once.
+  //! \param from The model index to run first.
+  //! \param to The model index to run after.
+  //! \param successors The successors of the graph.
+  //! \param predecessors_numbers The number of predecessors of the graph.
+  static void
+  addEdge(std::size_t /* from */, std::size_t /* to */,
+          std::vector<std::vector<std::size_t>> & /* successors */,
+          std::vector<std::size_t> & /* predecessors_numbers */);
+};
+
+} // namespace Seaplanes
+
+#endif // LOGICALPROCESSORMODELSCHEDULER_H
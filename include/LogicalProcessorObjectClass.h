@@ -12,6 +12,7 @@
 #include <memory>
 #include <string>
 
+#include <LogicalProcessorAttribute.h>
 #include <LogicalProcessorCommon.h>
 
 namespace Seaplanes {
@@ -42,9 +43,18 @@ public:
   //! \return The object handle.
   RTI::ObjectClassHandle getHandle() const;
 
+  //! \brief Transport hint setter, for the attributes without their own.
+  //! \param transport The transport of the updates of the attributes.
+  void setTransport(Transport /* transport */);
+
+  //! \brief Transport hint getter.
+  //! \return The transport of the updates of the attributes.
+  Transport getTransport() const;
+
 private:
   RTI::ObjectClassHandle __handle_; //!< Object handle.
   Name __name_;                     //!< Object name.
+  Transport __transport_;           //!< Transport hint of the attributes.
 
   //! \brief Object constructor.
   //! \param  name The name of the object.
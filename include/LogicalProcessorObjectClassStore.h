@@ -0,0 +1,165 @@
+//! \file    LogicalProcessorObjectClassStore.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor struct-of-arrays attributes storage.
+//!
+//! This class provides an optional storage of the attributes values of all
+//! the object instances of a class, as one contiguous and aligned array per
+//! attribute. Object instances bound to a store read and write their values in
+//! it when updating and reflecting, their attributes then only provide names
+//! and handles. Models can process whole fleets of instances through spans on
+//! the arrays, with loops the compiler can vectorize.
+
+#ifndef LOGICALPROCESSOROBJECTCLASSSTORE_H
+#define LOGICALPROCESSOROBJECTCLASSSTORE_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <LogicalProcessorCommon.h>
+
+namespace Seaplanes {
+
+//! \brief Non owning view on a contiguous array.
+template <typename T> class Span final {
+public:
+  //! \brief Span constructor.
+  //! \param p_data Pointer to the first element.
+  //! \param size Number of elements.
+  Span(T * /* p_data */, std::size_t /* size */);
+
+  //! \brief Pointer to the first element getter.
+  //! \return The pointer to the first element.
+  T *data() const;
+
+  //! \brief Number of elements getter.
+  //! \return The number of elements.
+  std::size_t size() const;
+
+  //! \brief Element access, unchecked.
+  //! \param index The index of the element.
+  //! \return The element.
+  T &operator[](std::size_t /* index */) const;
+
+  //! \brief First element iterator.
+  //! \return The iterator.
+  T *begin() const;
+
+  //! \brief Past the last element iterator.
+  //! \return The iterator.
+  T *end() const;
+
+private:
+  T *__p_data_;       //!< First element.
+  std::size_t __size_; //!< Number of elements.
+};
+
+//! \brief Type for object class store shared pointer.
+using SpObjectClassStore = std::shared_ptr<class ObjectClassStore>;
+
+//! \brief Type for vector of object class store shared pointers.
+using VecSpObjectClassStore = std::vector<SpObjectClassStore>;
+
+class ObjectClassStore final {
+public:
+  //! Alignment of each attribute array, in bytes.
+  static constexpr std::size_t alignment = 64;
+
+  //! \brief Store state, values and freshness flags, for state saving.
+  struct State {
+    std::vector<double> values{};       //!< Values, by column.
+    std::vector<unsigned char> fresh{}; //!< Freshness flags, by column.
+  };
+
+  ~ObjectClassStore() = default;
+  ObjectClassStore(const ObjectClassStore &) = delete;
+  void operator=(const ObjectClassStore &) = delete;
+  ObjectClassStore(ObjectClassStore &&) = delete;
+  void operator=(ObjectClassStore &&) = delete;
+
+  //! \brief Object class store factory builder.
+  //! \param attributes_names The names of the stored attributes.
+  //! \param capacity The maximum number of object instances.
+  //! \return The store in a shared pointer.
+  static SpObjectClassStore create(std::vector<Name> /* attributes_names */,
+                                   std::size_t /* capacity */);
+
+  //! \brief Reserve the slot of a new object instance.
+  //! \return The slot of the object instance.
+  //! \throw std::length_error if the store is full.
+  std::size_t addInstance();
+
+  //! \brief Number of object instances getter.
+  //! \return The number of object instances.
+  std::size_t getSize() const;
+
+  //! \brief Column of an attribute getter.
+  //! \param attribute_name The name of the attribute.
+  //! \return The column of the attribute.
+  //! \throw std::out_of_range if the attribute is not stored.
+  std::size_t getColumn(const Name & /* attribute_name */) const;
+
+  //! \brief Values of an attribute for all the object instances.
+  //! \param column The column of the attribute.
+  //! \return The values, indexed by slot.
+  Span<double> getValues(std::size_t /* column */);
+
+  //! \brief Values of an attribute for all the object instances.
+  //! \param column The column of the attribute.
+  //! \return The values, indexed by slot.
+  Span<const double> getValues(std::size_t /* column */) const;
+
+  //! \brief Freshness of an attribute for all the object instances, set when
+  //! a value is written, to be reset by the model.
+  //! \param column The column of the attribute.
+  //! \return The freshness flags, indexed by slot.
+  Span<unsigned char> getFresh(std::size_t /* column */);
+
+  //! \brief Value of an attribute of an object instance getter.
+  //! \param column The column of the attribute.
+  //! \param slot The slot of the object instance.
+  //! \return The value.
+  double getValue(std::size_t /* column */, std::size_t /* slot */) const;
+
+  //! \brief Value of an attribute of an object instance setter.
+  //! \param column The column of the attribute.
+  //! \param slot The slot of the object instance.
+  //! \param value The value.
+  void setValue(std::size_t /* column */, std::size_t /* slot */,
+                double /* value */);
+
+  //! \brief Store state getter.
+  //! \param[out] state The values and freshness flags of all the slots,
+  //! reusing its storage.
+  void getState(State & /* state */) const;
+
+  //! \brief Store state setter.
+  //! \param state The values and freshness flags of all the slots, from
+  //! getState.
+  void setState(const State & /* state */);
+
+private:
+  std::vector<Name> __attributes_names_; //!< Stored attributes names.
+  std::size_t __capacity_;               //!< Maximum number of instances.
+  std::size_t __size_;                   //!< Number of instances.
+  std::size_t __stride_; //!< Distance between columns, in values.
+
+  std::vector<double> __buffer_; //!< Values, with room for alignment.
+  double *__p_values_;           //!< First aligned column.
+
+  std::vector<unsigned char> __fresh_; //!< Freshness flags, by column.
+
+  //! \brief Object class store constructor.
+  //! \param attributes_names The names of the stored attributes.
+  //! \param capacity The maximum number of object instances.
+  ObjectClassStore(std::vector<Name> /* attributes_names */,
+                   std::size_t /* capacity */);
+};
+
+#include <LogicalProcessorObjectClassStore.tcc>
+
+} // namespace Seaplanes
+
+#endif // LOGICALPROCESSOROBJECTCLASSSTORE_H
@@ -16,6 +16,8 @@
 #include <LogicalProcessorAttribute.h>
 #include <LogicalProcessorCommon.h>
 #include <LogicalProcessorObjectClass.h>
+#include <LogicalProcessorObjectClassStore.h>
+#include <LogicalProcessorRegion.h>
 
 #ifndef USE_CERTI_MESSAGE_BUFFER
 // USE_CERTI_MESSAGE_BUFFER. If set to 1, use CERTI message buffer to send
@@ -58,8 +60,13 @@ public:
 
   //! \brief Add an attribute to the object instance.
   //! \param sp_attribute A shared pointer to the attribute to add.
+  //! \throw std::out_of_range If bound to a store not storing the attribute.
   void addAttribute(SpAttribute /* sp_attribute */);
 
+  //! \brief Attributes getter.
+  //! \return The attributes of the object instance.
+  const VecSpAttribute &getAttributes() const;
+
   //! \brief Set the handles of the object instance attributes
   //! \param  p_rtia A pointer to the RTIA
   void setAttributesHandles(RTI::RTIambassador * /* p_rtia */);
@@ -74,6 +81,44 @@ public:
   //! \return True if discovered, else false.
   bool getDiscovered() const;
 
+  //! \brief Set the DDM region of the object instance, to be done before
+  //! running. Published object instances updates are associated with it,
+  //! subscribed object instances only receive updates overlapping it.
+  //! \param sp_region A shared pointer to the region.
+  void setRegion(SpRegion /* sp_region */);
+
+  //! \brief DDM region getter.
+  //! \return The region of the object instance, null if none.
+  const SpRegion &getRegion() const;
+
+  //! \brief Bind the object instance to a struct-of-arrays store, to be done
+  //! before running. The values of the attributes are then read and written
+  //! in the store, in the slot reserved for the instance. Each attribute of
+  //! the instance must be stored.
+  //! \param sp_store A shared pointer to the store.
+  //! \throw std::out_of_range If an attribute is not stored.
+  void setStore(SpObjectClassStore /* sp_store */);
+
+  //! \brief Store getter.
+  //! \return The store of the object instance, null if none.
+  const SpObjectClassStore &getStore() const;
+
+  //! \brief Store slot getter.
+  //! \return The slot of the object instance in its store.
+  std::size_t getStoreSlot() const;
+
+  //! \brief Attribute value getter, from the store if bound to one, else from
+  //! the attribute.
+  //! \param index The attribute index, in the attributes order.
+  //! \return The value.
+  double getAttributeValue(std::size_t /* index */) const;
+
+  //! \brief Attribute value setter, in the store if bound to one, else in the
+  //! attribute.
+  //! \param index The attribute index, in the attributes order.
+  //! \param value The value.
+  void setAttributeValue(std::size_t /* index */, double /* value */);
+
 protected:
   Name __name_;
 
@@ -95,6 +140,24 @@ protected:
   //! True if the object instance is discovered, else false.
   bool __discovered_;
 
+  //! The DDM region of the object instance, null if none.
+  SpRegion __sp_region_;
+
+  //! The struct-of-arrays store of the object instance, null if none.
+  SpObjectClassStore __sp_store_;
+
+  //! The slot of the object instance in its store.
+  std::size_t __store_slot_;
+
+  //! The store columns of the attributes, in the attributes order.
+  std::vector<std::size_t> __store_columns_;
+
+  //! \brief Get the index of an attribute of the object instance.
+  //! \param sp_attribute The attribute.
+  //! \return The index of the attribute, in the attributes order.
+  //! \throw std::invalid_argument If the attribute is not added.
+  std::size_t getAttributeIndex(const SpAttribute & /* sp_attribute */) const;
+
   //! \brief Object instance constructor.
   //! \param  name The name of the object.
   //! \param  object The object which the object instance belongs to.
@@ -5,14 +5,33 @@
 //! \brief   Logical processor Published object instance manipulation.
 //!
 //! This class provides a simple way to use published object instance.
+//!
+//! Each attribute has an update policy, deciding if it is sent at an update:
+//! always, on change, out of a dead-band, every N updates, or dead reckoned,
+//! only when the extrapolation of its last sent values, done the same way by
+//! the subscribers, is too far from its value. Dead reckoned updates are
+//! expected to be time stamped, the extrapolation using their time stamps.
+//!
+//! Each attribute is delivered in time stamp order, by default, or in receive
+//! order: advisory values, for displays or monitors, are then sent without
+//! time stamp, out of the time stamp ordered queues of the subscribers, and
+//! reflected as soon as ticked in, at the time of their last grant.
+//!
+//! Attributes are sent with the transport hint of their own, else of their
+//! object class, \see Attribute::setTransport. Best effort attributes are
+//! switched to the best effort transport when registering, and are sent in
+//! separate updates from the reliable ones.
 
 #ifndef LOGICALPROCESSOROBJECTINSTANCEPUBLISHED_H
 #define LOGICALPROCESSOROBJECTINSTANCEPUBLISHED_H
 
+#include <array>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <LogicalProcessorCommon.h>
+#include <LogicalProcessorUpdatePolicy.h>
 #include <LogicalProcessorObjectInstance.h>
 
 namespace Seaplanes {
@@ -40,32 +59,218 @@ public:
   //! \param p_rtia A pointer to the RTIA.
   void registering(RTI::RTIambassador * /* p_rtia */);
 
-  //! \brief Update the published object instance attributes values.
+  //! \brief Update the published object instance attributes values, selected
+  //! by their update policies if not already done for the update. The time
+  //! stamped values are sent in a single update, whatever their transport.
   //! \param p_rtia A pointer to the RTIA.
   //! \param p_message_buffer A pointer to a buffer to send the values.
   //! \param time The timestamp.
   //! \param tag A tag.
-  void updateAttributeValues(RTI::RTIambassador * /* p_rtia */,
-                             libhla::MessageBuffer * /* p_message_buffer */,
-                             const RTIfedTime & /* time */,
-                             const Tag & /* tag */);
+  //! \return The handle to retract the update.
+  RTI::EventRetractionHandle
+  updateAttributeValues(RTI::RTIambassador * /* p_rtia */,
+                        libhla::MessageBuffer * /* p_message_buffer */,
+                        const RTIfedTime & /* time */, const Tag & /* tag */);
 
   //! \brief Update the published object instance attributes values.
   //! \param p_rtia A pointer to the RTIA.
   //! \param p_message_buffer A pointer to a buffer to send the values.
   //! \param time The timestamp.
-  void updateAttributeValues(RTI::RTIambassador * /* p_rtia */,
-                             libhla::MessageBuffer * /* p_message_buffer */,
-                             const RTIfedTime & /* time */);
+  //! \return The handle to retract the update.
+  RTI::EventRetractionHandle
+  updateAttributeValues(RTI::RTIambassador * /* p_rtia */,
+                        libhla::MessageBuffer * /* p_message_buffer */,
+                        const RTIfedTime & /* time */);
+
+  //! \brief Update the time stamped attributes values of a transport,
+  //! selected by their update policies if not already done at that time, once
+  //! for the updates of both transports.
+  //! \param p_rtia A pointer to the RTIA.
+  //! \param p_message_buffer A pointer to a buffer to send the values.
+  //! \param time The timestamp.
+  //! \param tag A tag.
+  //! \param transport The transport, reliable or best effort.
+  //! \return The handle to retract the update.
+  RTI::EventRetractionHandle
+  updateAttributeValues(RTI::RTIambassador * /* p_rtia */,
+                        libhla::MessageBuffer * /* p_message_buffer */,
+                        const RTIfedTime & /* time */, const Tag & /* tag */,
+                        Transport /* transport */);
+
+  //! \brief Update without time stamp the receive order attributes values,
+  //! selected by their update policies if not already done at that time, an
+  //! update per transport.
+  //! \param p_rtia A pointer to the RTIA.
+  //! \param p_message_buffer A pointer to a buffer to send the values.
+  //! \param time The time of the update, to select the values.
+  //! \param tag A tag.
+  void updateReceiveOrderValues(RTI::RTIambassador * /* p_rtia */,
+                                libhla::MessageBuffer * /* p_message_buffer */,
+                                const RTIfedTime & /* time */,
+                                const Tag & /* tag */);
 
   //! \brief Unpublish the published object instance.
   //! \param p_rtia A pointer to the RTIA.
   void unpublish(RTI::RTIambassador * /* p_rtia */);
 
+  //! \brief Follow the relevance advisories: attributes are only sent once
+  //! turned on by the RTI, when some federate subscribes to them. To be set
+  //! before registering.
+  void setRelevanceAdvised();
+
+  //! \brief Class relevance advisory, no federate subscribes to the object
+  //! class anymore, all the attributes are turned off, and their update
+  //! policies reset for the next subscribers.
+  void stopRegistration();
+
+  //! \brief Attribute relevance advisory, turn on attributes updates, their
+  //! update policies reset for the new subscribers to get their values.
+  //! \param handles The handles of the attributes to turn on.
+  void turnUpdatesOn(const RTI::AttributeHandleSet & /* handles */);
+
+  //! \brief Attribute relevance advisory, turn off attributes updates.
+  //! \param handles The handles of the attributes to turn off.
+  void turnUpdatesOff(const RTI::AttributeHandleSet & /* handles */);
+
+  //! \brief Get if some attribute of the instance is to be sent.
+  //! \return True if at least one attribute is relevant, else false.
+  bool getUpdatesRelevant() const;
+
+  //! \brief Set the update policy of an attribute.
+  //! \param sp_attribute The attribute, added to the object instance.
+  //! \param policy The update policy.
+  void setUpdatePolicy(const SpAttribute & /* sp_attribute */,
+                       UpdatePolicy /* policy */);
+
+  //! \brief Update policies getter.
+  //! \return The update policies, in the attributes order once registered.
+  const std::vector<UpdatePolicy> &getUpdatePolicies() const;
+
+  //! \brief Update policies setter, with their states, for state saving.
+  //! \param policies The update policies, from getUpdatePolicies.
+  void setUpdatePolicies(const std::vector<UpdatePolicy> & /* policies */);
+
+  //! \brief Dead reckon an attribute, sent only when the subscribers
+  //! extrapolation of the same order would be off by more than a threshold.
+  //! \param sp_attribute The attribute, added to the object instance.
+  //! \param order The extrapolation order of the subscribers.
+  //! \param threshold The maximum extrapolation error, negative to always send
+  //! the attribute.
+  void setDeadReckoning(const SpAttribute & /* sp_attribute */,
+                        Extrapolator::Order /* order */,
+                        double /* threshold */);
+
+  //! \brief Deliver an attribute in receive order, without time stamp. Not
+  //! supported by the optimistic time management policy, the updates not
+  //! being retractable.
+  //! \param sp_attribute The attribute, added to the object instance.
+  void setReceiveOrder(const SpAttribute & /* sp_attribute */);
+
+  //! \brief Deliver all the attributes added to the object instance in receive
+  //! order, without time stamp. Not supported by the optimistic time
+  //! management policy.
+  void setReceiveOrder();
+
+  //! \brief Check if some attributes are delivered in receive order.
+  //! \return True if at least one attribute is delivered in receive order,
+  //! else false.
+  bool hasReceiveOrder() const;
+
+  //! \brief Select the attributes to send at an update, relevant and passing
+  //! their update policies, once per update.
+  //! \param time The timestamp of the update.
+  //! \return True if at least one attribute is to be sent, else false.
+  bool selectUpdates(const RTIfedTime & /* time */);
+
+  //! \brief Get the number of time stamped values of the last update.
+  //! \return The number of time stamp order values selected for the last
+  //! update.
+  std::size_t getUpdateSize() const;
+
+  //! \brief Get the number of time stamped values of a transport of the last
+  //! update.
+  //! \param transport The transport, reliable or best effort.
+  //! \return The number of time stamp order values of the transport selected
+  //! for the last update.
+  std::size_t getUpdateSize(Transport /* transport */) const;
+
+  //! \brief Get the number of receive order values of the last update.
+  //! \return The number of receive order values selected for the last update.
+  std::size_t getReceiveOrderUpdateSize() const;
+
 private:
   friend UpObjectInstancePublished std::make_unique<ObjectInstancePublished>(
       Name &&, std::shared_ptr<Seaplanes::Object> &);
 
+  bool __relevance_advised_; //!< True if following relevance advisories.
+
+  //! Relevance of each attribute, in the attributes order, if advised.
+  std::vector<bool> __relevant_attributes_;
+
+  //! Number of relevant attributes, if advised.
+  std::size_t __relevant_attributes_number_;
+
+  std::vector<double> __values_; //!< Values to send, before encoding.
+  std::vector<unsigned char> __encoded_values_; //!< Encoded values to send.
+
+  //! Handles of the encoded values to send.
+  std::vector<RTI::AttributeHandle> __encoded_handles_;
+
+  //! Update policies, by attribute index.
+  std::vector<UpdatePolicy> __update_policies_;
+
+  //! Receive order delivery, by attribute index.
+  std::vector<bool> __receive_ordered_;
+
+  //! \brief Groups of values sent in the same updates, by ordering and
+  //! transport.
+  enum Group : std::size_t {
+    TSO_RELIABLE,    //!< Time stamp order, reliable.
+    TSO_BEST_EFFORT, //!< Time stamp order, best effort.
+    RO_RELIABLE,     //!< Receive order, reliable.
+    RO_BEST_EFFORT,  //!< Receive order, best effort.
+    GROUPS_NUMBER    //!< Number of groups.
+  };
+
+  //! Group of each attribute, by attribute index.
+  std::vector<Group> __attribute_groups_;
+
+  //! Index of the first value of each group, in the values to send.
+  std::array<std::size_t, GROUPS_NUMBER> __group_starts_;
+
+  //! Number of values to send of each group.
+  std::array<std::size_t, GROUPS_NUMBER> __group_counts_;
+
+  bool __updates_selected_; //!< True if the values to send are selected.
+  SeaplanesTime __selected_time_; //!< Time stamp of the selected values.
+
+  //! \brief Select the values to send, unless already done at that time.
+  //! \param time The timestamp of the update.
+  void updatesSelecting(const RTIfedTime & /* time */);
+
+  //! \brief Group the attributes by ordering and transport, the values of
+  //! each group being contiguous.
+  void grouping();
+
+  //! \brief Get the transport of an attribute, from its hint or the object
+  //! class one.
+  //! \param index The attribute index.
+  //! \return The transport, reliable or best effort.
+  Transport getTransport(std::size_t /* index */) const;
+
+  //! \brief Encode values of a group, added to the instance attributes to
+  //! send.
+  //! \param p_message_buffer A pointer to a buffer to send the values.
+  //! \param group The group of the values.
+  void encodeValues(libhla::MessageBuffer * /* p_message_buffer */,
+                    Group /* group */);
+
+  //! \brief Set the relevance of attributes.
+  //! \param handles The handles of the attributes.
+  //! \param relevant True if the attributes are relevant, else false.
+  void setRelevance(const RTI::AttributeHandleSet & /* handles */,
+                    bool /* relevant */);
+
   //! \brief Published object instance constructor.
   //! \param name The name of the object.
   //! \param sp_object The object which the object instance belongs to.
@@ -5,15 +5,27 @@
 //! \brief   Logical processor Subscribed object instance manipulation.
 //!
 //! This class provides a simple way to use subscribed object instance.
+//!
+//! Received values are double buffered: reflections are written to a back
+//! buffer, possibly from another thread, while the attributes keep the values
+//! of the step. The back buffer is swapped, and its values written to the
+//! attributes, at the updates reception.
+//!
+//! Attributes can be extrapolated between two updates, from their last time
+//! stamped values, so that publishers can update them less often.
 
 #ifndef LOGICALPROCESSOROBJECTINSTANCESUBSCRIBED_H
 #define LOGICALPROCESSOROBJECTINSTANCESUBSCRIBED_H
 
+#include <array>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <LogicalProcessorCommon.h>
+#include <LogicalProcessorExtrapolator.h>
 #include <LogicalProcessorObjectInstance.h>
 
 namespace Seaplanes {
@@ -25,6 +37,9 @@ using UpObjectInstanceSubscribed =
 //! \brief Type for Map Handles <-> Attribute shared pointers.
 using MapHandleSpAttribute = std::map<RTI::AttributeHandle, SpAttribute>;
 
+//! \brief Type for Map Handles <-> attributes indexes.
+using MapHandleIndex = std::map<RTI::AttributeHandle, std::size_t>;
+
 class ObjectInstanceSubscribed final : public ObjectInstance {
 public:
   //! \brief Subscribed object instance factory builder.
@@ -41,10 +56,6 @@ public:
   //! \param p_rtia A pointer to the RTIA.
   void subscribeObjectClassAttributes(RTI::RTIambassador * /* p_rtia */);
 
-  //! \brief Wait for registering.
-  //! \param p_rtia A pointer to the RTIA.
-  void waitRegistering(RTI::RTIambassador * /* p_rtia */);
-
   //! \brief Unsubscribe to the object class attributes.
   //! \param p_rtia A pointer to the RTIA.
   void unsubscribe(RTI::RTIambassador * /* p_rtia */);
@@ -57,17 +68,109 @@ public:
                      const RTI::ObjectClassHandle & /* object_class_handle */,
                      const RTI::ObjectHandle & /* object_handle */);
 
-  //! \brief Reflects the attributes values.
+  //! \brief Reflects the attributes values. Values in network byte order are
+  //! decoded at once, and written to the back buffer.
   //! \param  &values The values to reflect.
+  //! \param time The time stamp of the reflection.
+  //! \param time_stamped True if the reflection is time stamped, false if
+  //! received in order.
   void
-  reflectAttributeValues(const RTI::AttributeHandleValuePairSet & /* values */);
+  reflectAttributeValues(const RTI::AttributeHandleValuePairSet & /* values */,
+                         SeaplanesTime /* time */, bool /* time_stamped */);
+
+  //! \brief Set the extrapolation of an attribute between two updates. The
+  //! attribute is then written at each swap with its value extrapolated to the
+  //! local time, its freshness still telling if an update was received.
+  //! \param sp_attribute The attribute, added to the object instance.
+  //! \param order The extrapolation order, zero for none.
+  void setExtrapolation(const SpAttribute & /* sp_attribute */,
+                        Extrapolator::Order /* order */);
+
+  //! \brief Extrapolators getter, for state saving.
+  //! \return The extrapolators, by attribute index, empty if no extrapolation
+  //! is set.
+  const std::vector<Extrapolator> &getExtrapolators() const;
+
+  //! \brief Extrapolators setter, for state saving.
+  //! \param extrapolators The extrapolators, from getExtrapolators.
+  void setExtrapolators(const std::vector<Extrapolator> & /* extrapolators */);
+
+  //! \brief Swap the buffers, writing the values received since the last swap
+  //! to the attributes or the store, and ageing the others of a step. From the
+  //! thread reading the attributes.
+  //! \param time The local time, to extrapolate the attributes to.
+  //! \return The number of values written.
+  std::size_t swapBuffers(SeaplanesTime /* time */);
+
+  //! \brief Write the extrapolated attributes with their values extrapolated
+  //! to a time, between two swaps, as at sub-steps.
+  //! \param time The local time, to extrapolate the attributes to.
+  void extrapolate(SeaplanesTime /* time */);
+
+  //! \brief Discard the time stamped values received since the last swap,
+  //! replayed on rollbacks, keeping the values received in order. From the
+  //! thread writing the back buffer.
+  void discardBuffers();
 
 private:
+  //! \brief Received values buffer.
+  struct Buffer {
+    std::vector<double> values{};       //!< Values, by attribute index.
+    std::vector<SeaplanesTime> times{}; //!< Time stamps, by attribute index.
+    std::vector<bool> updated{};        //!< True if received, by index.
+    std::vector<std::size_t> indexes{}; //!< Indexes of the received values.
+    std::size_t size{0};                //!< Number of received values.
+
+    //! True if the value is time stamped, by index.
+    std::vector<bool> time_stamped{};
+
+    //! Values received in order, then overwritten by time stamped ones, kept
+    //! for rollbacks, by index.
+    std::vector<double> ordered_values{};
+
+    //! Time stamps of the values received in order, by index.
+    std::vector<SeaplanesTime> ordered_times{};
+
+    //! True if a value received in order is kept, by index.
+    std::vector<bool> ordered{};
+  };
+
+  //! Flag of the back buffer index, set while the back buffer is written.
+  static constexpr unsigned int writing = 2;
+
   friend UpObjectInstanceSubscribed std::make_unique<ObjectInstanceSubscribed>(
       Name &&, std::shared_ptr<Seaplanes::Object> &);
 
-  MapHandleSpAttribute
-      __map_sp_attributes_; //!< Map on attribute for faster access when in RAV.
+  MapHandleIndex
+      __map_attributes_indexes_; //!< Map on attributes indexes, for RAV.
+
+  std::vector<unsigned char> __encoded_values_; //!< Received encoded values.
+  std::vector<double> __decoded_values_;        //!< Received decoded values.
+
+  //! Attributes indexes of the received values.
+  std::vector<std::size_t> __decoded_indexes_;
+
+  std::array<Buffer, 2> __buffers_; //!< Front and back buffers.
+
+  //! Index of the back buffer, with the writing flag.
+  std::atomic<unsigned int> __back_buffer_;
+
+  //! Extrapolators, by attribute index, if some extrapolation is set.
+  std::vector<Extrapolator> __extrapolators_;
+
+  //! Indexes of the extrapolated attributes.
+  std::vector<std::size_t> __extrapolated_indexes_;
+
+  //! \brief Decode the attributes values.
+  //! \param values The values to decode.
+  //! \return The number of decoded values.
+  std::size_t
+  decodeAttributeValues(const RTI::AttributeHandleValuePairSet & /* values */);
+
+  //! \brief Take the back buffer for reading, the other one becoming the back
+  //! buffer.
+  //! \return The previous back buffer.
+  Buffer &takeBackBuffer();
 
   //! \brief Subscribed object instance constructor.
   //! \param  name The name of the object.
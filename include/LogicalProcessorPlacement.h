@@ -0,0 +1,96 @@
+//! \file    LogicalProcessorPlacement.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor thread placement.
+//!
+//! This class provides a simple way to pin the simulation loop thread and the
+//! RTIA process spawned by CERTI to given CPU sets. Pinning the simulation
+//! thread as soon as it is configured makes the memory allocated afterwards
+//! (attributes, object instances) land on the local NUMA node, the Linux
+//! default policy allocating pages on the node of the CPU first touching them.
+//! Placement is only available on Linux, other systems only report it.
+
+#ifndef LOGICALPROCESSORPLACEMENT_H
+#define LOGICALPROCESSORPLACEMENT_H
+
+#include <set>
+#include <string>
+
+#include <sys/types.h>
+
+namespace Seaplanes {
+
+//! \brief Type for a set of CPU indexes.
+using CpuSet = std::set<unsigned int>;
+
+class Placement final {
+public:
+  Placement();
+  ~Placement() = default;
+  Placement(const Placement &) = delete;
+  void operator=(const Placement &) = delete;
+  Placement(Placement &&) = default;
+  void operator=(Placement &&) = delete;
+
+  //! \brief Pin the calling thread, the simulation loop thread, to CPUs.
+  //! Applied immediately so following allocations are NUMA local.
+  //! \param cpus The CPU set, empty to leave the thread unpinned.
+  //! \throw std::invalid_argument If a CPU is out of the CPU sets range.
+  void setSimulationAffinity(CpuSet /* cpus */);
+
+  //! \brief Pin the RTIA process spawned for the LP to CPUs.
+  //! \param cpus The CPU set, empty to leave the RTIA unpinned.
+  //! \throw std::invalid_argument If a CPU is out of the CPU sets range.
+  void setRtiaAffinity(CpuSet /* cpus */);
+
+  //! \brief Apply the configured placement to the simulation thread and the
+  //! RTIA process.
+  void apply();
+
+  //! \brief Log the applied placement.
+  void report() const;
+
+  //! \brief CPU set to string.
+  //! \param cpus The CPU set.
+  //! \return The CPU set as a comma separated list.
+  static std::string toString(const CpuSet & /* cpus */);
+
+private:
+  CpuSet __simulation_cpus_; //!< CPUs of the simulation loop thread.
+  CpuSet __rtia_cpus_;       //!< CPUs of the RTIA process.
+  pid_t __rtia_pid_;         //!< RTIA process id, 0 if unknown.
+
+  //! \brief Pin the calling thread.
+  //! \param cpus The CPU set.
+  //! \return True if the affinity was applied.
+  static bool pinCurrentThread(const CpuSet & /* cpus */);
+
+  //! \brief Pin all the threads of a process.
+  //! \param pid The process id.
+  //! \param cpus The CPU set.
+  //! \return True if the affinity was applied to every thread.
+  static bool pinProcess(pid_t /* pid */, const CpuSet & /* cpus */);
+
+  //! \brief Get the calling thread affinity.
+  //! \return The CPU set the thread can run on.
+  static CpuSet getCurrentThreadAffinity();
+
+  //! \brief Get a process affinity.
+  //! \param pid The process id.
+  //! \return The CPU set the process can run on.
+  static CpuSet getProcessAffinity(pid_t /* pid */);
+
+  //! \brief Get the NUMA nodes of CPUs.
+  //! \param cpus The CPU set.
+  //! \return The set of NUMA nodes of the CPUs.
+  static std::set<int> getNumaNodes(const CpuSet & /* cpus */);
+
+  //! \brief Find the RTIA process spawned by this process.
+  //! \return The RTIA process id, 0 if not found.
+  static pid_t findRtiaPid();
+};
+
+} // namespace Seaplanes
+
+#endif // LOGICALPROCESSORPLACEMENT_H
@@ -0,0 +1,95 @@
+//! \file    LogicalProcessorRegion.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor DDM region manipulation.
+//!
+//! This class provides a simple way to use data distribution management
+//! regions. A region is declared in a routing space of the FOM, by ranges on
+//! its dimensions. Subscribed object instances with a region only receive the
+//! updates of the published object instances whose region overlaps it, the
+//! others being dropped by the RTI.
+
+#ifndef LOGICALPROCESSORREGION_H
+#define LOGICALPROCESSORREGION_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <LogicalProcessorCommon.h>
+
+namespace Seaplanes {
+
+//! \brief Type for region shared pointer.
+using SpRegion = std::shared_ptr<class Region>;
+
+class Region final {
+public:
+  ~Region() = default;
+  Region(const Region &) = delete;
+  void operator=(const Region &) = delete;
+  Region(Region &&) = delete;
+  void operator=(Region &&) = delete;
+
+  //! \brief Region factory builder.
+  //! \param space_name The name of the routing space.
+  //! \param extents_number The number of extents of the region.
+  //! \return The region in a shared pointer.
+  static SpRegion create(Name /* space_name */,
+                         unsigned int /* extents_number */ = 1);
+
+  //! \brief Routing space name getter.
+  //! \return The name of the routing space.
+  Name getSpaceName() const;
+
+  //! \brief Set the range of a region extent on a dimension. Can be called
+  //! during the simulation, for moving regions, on dimensions already set
+  //! before the region creation.
+  //! \param dimension_name The name of the dimension.
+  //! \param lower The lower bound, between RTI::MIN_EXTENT and RTI::MAX_EXTENT.
+  //! \param upper The upper bound, between RTI::MIN_EXTENT and RTI::MAX_EXTENT.
+  //! \param extent The index of the extent.
+  void setRange(const Name & /* dimension_name */, RTI::ULong /* lower */,
+                RTI::ULong /* upper */, unsigned int /* extent */ = 0);
+
+  //! \brief Create the region in the RTI, if not already done.
+  //! \param p_rtia A pointer to the RTIA.
+  void createRegion(RTI::RTIambassador * /* p_rtia */);
+
+  //! \brief Notify the RTI of the ranges modifications, if any.
+  //! \param p_rtia A pointer to the RTIA.
+  void notifyModification(RTI::RTIambassador * /* p_rtia */);
+
+  //! \brief Delete the region in the RTI, if created.
+  //! \param p_rtia A pointer to the RTIA.
+  void deleteRegion(RTI::RTIambassador * /* p_rtia */);
+
+  //! \brief RTI region getter, once created.
+  //! \return The RTI region.
+  RTI::Region &getRegion() const;
+
+private:
+  //! \brief Type for ranges of an extent, by dimension name.
+  using MapNameRange = std::map<Name, std::pair<RTI::ULong, RTI::ULong>>;
+
+  Name __space_name_;                  //!< Routing space name.
+  std::vector<MapNameRange> __ranges_; //!< Ranges of each extent.
+
+  //! Dimensions handles, fetched on creation.
+  std::map<Name, RTI::DimensionHandle> __dimensions_handles_;
+
+  RTI::Region *__p_region_; //!< RTI region, null until created.
+  bool __modified_;         //!< True if ranges changed since notification.
+
+  //! \brief Region constructor.
+  //! \param space_name The name of the routing space.
+  //! \param extents_number The number of extents of the region.
+  Region(Name /* space_name */, unsigned int /* extents_number */);
+};
+
+} // namespace Seaplanes
+
+#endif // LOGICALPROCESSORREGION_H
@@ -0,0 +1,138 @@
+//! \file    LogicalProcessorStateSaver.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor incremental state saving.
+//!
+//! This class provides checkpoints of the attributes of a logical processor,
+//! for rollback. States are saved incrementally: a checkpoint only stores the
+//! previous state of the attributes that changed since the last checkpoint,
+//! and a rollback undoes checkpoints from the newest one. The values of the
+//! struct-of-arrays stores, not kept by their attributes, the extrapolators
+//! of the subscribed object instances, and the update policies of the
+//! published ones, last values sent and ages, are saved whole at each
+//! checkpoint.
+
+#ifndef LOGICALPROCESSORSTATESAVER_H
+#define LOGICALPROCESSORSTATESAVER_H
+
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include <LogicalProcessorAttribute.h>
+#include <LogicalProcessorObjectClassStore.h>
+#include <LogicalProcessorObjectInstance.h>
+#include <LogicalProcessorObjectInstancePublished.h>
+#include <LogicalProcessorObjectInstanceSubscribed.h>
+#include <SeaplanesTime.h>
+
+namespace Seaplanes {
+
+//! \brief Type for vector of event retraction handles.
+using VecEventRetractionHandle = std::vector<RTI::EventRetractionHandle>;
+
+class StateSaver final {
+public:
+  StateSaver();
+  ~StateSaver() = default;
+  StateSaver(const StateSaver &) = delete;
+  void operator=(const StateSaver &) = delete;
+  StateSaver(StateSaver &&) = default;
+  void operator=(StateSaver &&) = delete;
+
+  //! \brief Set the attributes to save.
+  //! \param sp_attributes The attributes.
+  void track(VecSpAttribute /* sp_attributes */);
+
+  //! \brief Set the struct-of-arrays stores to save.
+  //! \param sp_stores The stores.
+  void trackStores(VecSpObjectClassStore /* sp_stores */);
+
+  //! \brief Set the subscribed object instances whose extrapolators are saved.
+  //! \param p_instances The object instances, outliving the state saver.
+  void trackExtrapolators(
+      std::vector<ObjectInstanceSubscribed *> /* p_instances */);
+
+  //! \brief Set the published object instances whose update policies are
+  //! saved.
+  //! \param p_instances The object instances, outliving the state saver.
+  void trackUpdatePolicies(
+      std::vector<ObjectInstancePublished *> /* p_instances */);
+
+  //! \brief Save the current attributes states.
+  //! \param time The time of the checkpoint.
+  //! \param step_number The step index of the checkpoint.
+  void checkpoint(SeaplanesTime /* time */,
+                  unsigned long long /* step_number */);
+
+  //! \brief Record messages sent from the newest checkpoint.
+  //! \param handles The retraction handles of the sent messages.
+  void recordSent(const VecEventRetractionHandle & /* handles */);
+
+  //! \brief Get the time of the oldest checkpoint at or after a time.
+  //! \param time The time.
+  //! \param[out] checkpoint_time The time of the checkpoint.
+  //! \return True if such a checkpoint exists, else false.
+  bool findCheckpoint(SeaplanesTime /* time */,
+                      SeaplanesTime & /* checkpoint_time */) const;
+
+  //! \brief Restore the attributes states of a checkpoint, discarding newer
+  //! checkpoints.
+  //! \param time The time of the checkpoint to restore.
+  //! \param[out] step_number The step index of the restored checkpoint.
+  //! \param[out] sent The messages sent since the restored checkpoint, to
+  //! retract.
+  void rollback(SeaplanesTime /* time */,
+                unsigned long long & /* step_number */,
+                VecEventRetractionHandle & /* sent */);
+
+  //! \brief Discard the checkpoints older than a time, that can no longer be
+  //! restored.
+  //! \param time The time.
+  void fossilCollect(SeaplanesTime /* time */);
+
+  //! \brief Number of checkpoints.
+  //! \return The number of checkpoints kept.
+  std::size_t size() const;
+
+private:
+  //! \brief Checkpoint record.
+  struct Checkpoint {
+    SeaplanesTime time;             //!< Time of the checkpoint.
+    unsigned long long step_number; //!< Step index of the checkpoint.
+
+    //! Previous states of the attributes changed since the last checkpoint.
+    std::vector<std::pair<std::size_t, Attribute::State>> undo;
+
+    //! Messages sent since the checkpoint.
+    VecEventRetractionHandle sent;
+
+    //! States of the stores at the checkpoint.
+    std::vector<ObjectClassStore::State> stores;
+
+    //! Extrapolators of the subscribed object instances at the checkpoint.
+    std::vector<std::vector<Extrapolator>> extrapolators;
+
+    //! Update policies of the published object instances at the checkpoint.
+    std::vector<std::vector<UpdatePolicy>> policies;
+  };
+
+  VecSpAttribute __sp_attributes_;    //!< Saved attributes.
+  VecSpObjectClassStore __sp_stores_; //!< Saved stores.
+
+  //! Object instances whose extrapolators are saved.
+  std::vector<ObjectInstanceSubscribed *> __p_extrapolated_instances_;
+
+  //! Object instances whose update policies are saved.
+  std::vector<ObjectInstancePublished *> __p_published_instances_;
+
+  //! Attributes states at the newest checkpoint.
+  std::vector<Attribute::State> __states_;
+
+  std::deque<Checkpoint> __checkpoints_; //!< Checkpoints, oldest first.
+};
+
+} // namespace Seaplanes
+
+#endif // LOGICALPROCESSORSTATESAVER_H
@@ -0,0 +1,82 @@
+//! \file    LogicalProcessorStatistics.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor execution statistics.
+//!
+//! This class accounts, in wall time, the time a logical processor spends
+//! blocked waiting for its grants and the time it spends computing, so the
+//! federate holding the federation back can be identified.
+
+#ifndef LOGICALPROCESSORSTATISTICS_H
+#define LOGICALPROCESSORSTATISTICS_H
+
+#include <chrono>
+
+namespace Seaplanes {
+
+//! \brief Type for the clock used to measure wall time.
+using WallClock = std::chrono::steady_clock;
+
+class Statistics final {
+public:
+  Statistics();
+
+  //! \brief Start of a blocking wait for a grant.
+  void startBlocking();
+
+  //! \brief End of a blocking wait for a grant.
+  void stopBlocking();
+
+  //! \brief Start of the local computation.
+  void startCompute();
+
+  //! \brief End of the local computation.
+  void stopCompute();
+
+  //! \brief Number of blocking waits.
+  //! \return The number of blocking waits.
+  unsigned long long getBlockingNumber() const;
+
+  //! \brief Last blocking wait duration.
+  //! \return The duration in seconds.
+  double getLastBlockedTime() const;
+
+  //! \brief Longest blocking wait duration.
+  //! \return The duration in seconds.
+  double getMaxBlockedTime() const;
+
+  //! \brief Total blocking wait duration.
+  //! \return The duration in seconds.
+  double getTotalBlockedTime() const;
+
+  //! \brief Last local computation duration.
+  //! \return The duration in seconds.
+  double getLastComputeTime() const;
+
+  //! \brief Longest local computation duration.
+  //! \return The duration in seconds.
+  double getMaxComputeTime() const;
+
+  //! \brief Total local computation duration.
+  //! \return The duration in seconds.
+  double getTotalComputeTime() const;
+
+private:
+  using Duration = std::chrono::duration<double>;
+
+  WallClock::time_point __blocking_start_; //!< Start of the current wait.
+  WallClock::time_point __compute_start_;  //!< Start of the computation.
+
+  unsigned long long __blocking_number_; //!< Number of blocking waits.
+  Duration __last_blocked_;              //!< Last blocking wait.
+  Duration __max_blocked_;               //!< Longest blocking wait.
+  Duration __total_blocked_;             //!< Total blocking wait.
+  Duration __last_compute_;              //!< Last computation.
+  Duration __max_compute_;               //!< Longest computation.
+  Duration __total_compute_;             //!< Total computation.
+};
+
+} // namespace Seaplanes
+
+#endif // LOGICALPROCESSORSTATISTICS_H
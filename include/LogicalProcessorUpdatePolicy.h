@@ -0,0 +1,133 @@
+//! \file    LogicalProcessorUpdatePolicy.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor published attribute update policy.
+//!
+//! This class decides, at each update of a published object instance, if an
+//! attribute is sent: always, on change, out of an absolute or relative
+//! dead-band, every N steps, or when the subscribers extrapolation is too far
+//! (dead reckoning). A maximum age forces a send after a number of steps
+//! without one, as a keepalive. Suppressed sends are counted. A reset, when
+//! subscribers appear, forces the next send.
+
+#ifndef LOGICALPROCESSORUPDATEPOLICY_H
+#define LOGICALPROCESSORUPDATEPOLICY_H
+
+#include <LogicalProcessorExtrapolator.h>
+#include <SeaplanesTime.h>
+
+namespace Seaplanes {
+
+class UpdatePolicy final {
+public:
+  //! \brief Update policy kind.
+  enum class Kind : unsigned int {
+    ALWAYS,             //!< Sent at each update.
+    ON_CHANGE,          //!< Sent when changed.
+    DEAD_BAND,          //!< Sent when changed by more than a threshold.
+    RELATIVE_DEAD_BAND, //!< Sent when changed by more than a ratio.
+    DECIMATION,         //!< Sent every N updates.
+    DEAD_RECKONING,     //!< Sent when extrapolated with too much error.
+  };
+
+  //! \brief Update policy constructor, sending at each update.
+  UpdatePolicy();
+
+  //! \brief Policy sending at each update.
+  //! \return The update policy.
+  static UpdatePolicy always();
+
+  //! \brief Policy sending when the value changed since the last send.
+  //! \return The update policy.
+  static UpdatePolicy onChange();
+
+  //! \brief Policy sending when the value changed by more than a threshold
+  //! since the last send.
+  //! \param threshold The threshold.
+  //! \return The update policy.
+  static UpdatePolicy deadBand(double /* threshold */);
+
+  //! \brief Policy sending when the value changed by more than a ratio of the
+  //! last sent value.
+  //! \param ratio The ratio.
+  //! \return The update policy.
+  static UpdatePolicy relativeDeadBand(double /* ratio */);
+
+  //! \brief Policy sending every N updates.
+  //! \param steps The number of updates between two sends.
+  //! \return The update policy.
+  static UpdatePolicy decimation(unsigned int /* steps */);
+
+  //! \brief Policy sending when the subscribers extrapolation of the same
+  //! order would be off by more than a threshold.
+  //! \param order The extrapolation order of the subscribers.
+  //! \param threshold The maximum extrapolation error.
+  //! \return The update policy.
+  static UpdatePolicy deadReckoning(Extrapolator::Order /* order */,
+                                    double /* threshold */);
+
+  //! \brief Set the maximum number of updates between two sends.
+  //! \param steps The maximum age, 0 for none.
+  //! \return The update policy.
+  UpdatePolicy &setMaxAge(unsigned int /* steps */);
+
+  //! \brief Kind getter.
+  //! \return The update policy kind.
+  Kind getKind() const;
+
+  //! \brief Decide if the value is sent at an update, and account for it.
+  //! \param value The value.
+  //! \param time The timestamp of the update.
+  //! \return True if the value is to be sent, else false.
+  bool select(double /* value */, SeaplanesTime /* time */);
+
+  //! \brief Forget the values sent, for the next value to be sent, as for new
+  //! subscribers. The counts are kept.
+  void reset();
+
+  //! \brief Number of sends.
+  //! \return The number of values selected to be sent.
+  unsigned long long getSentNumber() const;
+
+  //! \brief Number of suppressed sends.
+  //! \return The number of values not sent by the policy.
+  unsigned long long getSuppressedNumber() const;
+
+  //! \brief Number of keepalive sends.
+  //! \return The number of values sent for the maximum age only.
+  unsigned long long getKeepalivesNumber() const;
+
+private:
+  Kind __kind_;                 //!< Update policy kind.
+  double __threshold_;          //!< Dead-band threshold or ratio.
+  unsigned int __steps_;        //!< Decimation number of updates.
+  unsigned int __max_age_;      //!< Maximum age, 0 for none.
+  Extrapolator __extrapolator_; //!< Subscribers extrapolation mirror.
+
+  bool __sent_;        //!< True once a value is sent.
+  double __last_;      //!< Last sent value.
+  unsigned int __age_; //!< Updates since the last send.
+
+  unsigned long long __sent_number_;       //!< Number of sends.
+  unsigned long long __suppressed_number_; //!< Number of suppressed sends.
+  unsigned long long __keepalives_number_; //!< Number of keepalive sends.
+
+  //! \brief Get if the policy itself sends the value.
+  //! \param value The value.
+  //! \param time The timestamp of the update.
+  //! \return True if the value is to be sent, else false.
+  bool getChanged(double /* value */, SeaplanesTime /* time */) const;
+
+  //! \brief Update policy constructor.
+  //! \param kind The update policy kind.
+  //! \param threshold The dead-band threshold or ratio.
+  //! \param steps The decimation number of updates.
+  //! \param order The dead reckoning extrapolation order.
+  UpdatePolicy(Kind /* kind */, double /* threshold */,
+               unsigned int /* steps */, Extrapolator::Order /* order */);
+};
+
+} // namespace Seaplanes
+
+#endif // LOGICALPROCESSORUPDATEPOLICY_H
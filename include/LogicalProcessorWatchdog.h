@@ -0,0 +1,80 @@
+//! \file    LogicalProcessorWatchdog.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor time advance watchdog.
+//!
+//! This class runs a thread logging a diagnostic each time a pending time
+//! advance request exceeds a threshold, in wall time, without being granted.
+//! As the simulation thread is blocked in the RTI while waiting for the grant,
+//! the watchdog cannot be checked from the simulation loop itself.
+
+#ifndef LOGICALPROCESSORWATCHDOG_H
+#define LOGICALPROCESSORWATCHDOG_H
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <LogicalProcessorCommon.h>
+#include <LogicalProcessorStatistics.h>
+#include <SeaplanesTime.h>
+
+namespace Seaplanes {
+
+//! \brief Type for watchdog unique pointer.
+using UpWatchdog = std::unique_ptr<class Watchdog>;
+
+class Watchdog final {
+public:
+  //! \brief Create a watchdog, and start its thread.
+  //! \param federate_name The name of the watched federate, for diagnostics.
+  //! \param threshold The threshold, in seconds of wall time.
+  //! \return The new watchdog.
+  static UpWatchdog create(Name /* federate_name */, double /* threshold */);
+
+  //! \brief Watchdog destructor, stops its thread.
+  ~Watchdog();
+  Watchdog(const Watchdog &) = delete;
+  void operator=(const Watchdog &) = delete;
+  Watchdog(Watchdog &&) = delete;
+  void operator=(Watchdog &&) = delete;
+
+  //! \brief Start watching a time advance request.
+  //! \param requested_time The requested time.
+  //! \param granted_time The last granted time.
+  //! \param step_number The current step index.
+  void arm(SeaplanesTime /* requested_time */, SeaplanesTime /* granted_time */,
+           unsigned long long /* step_number */);
+
+  //! \brief Stop watching, the time advance is granted.
+  void disarm();
+
+private:
+  Name __federate_name_;            //!< Watched federate name.
+  WallClock::duration __threshold_; //!< Threshold in wall time.
+
+  std::mutex __mutex_;               //!< Protects the state below.
+  std::condition_variable __cv_;     //!< Wakes the thread on changes.
+  bool __running_;                   //!< False to stop the thread.
+  bool __armed_;                     //!< True while a request is pending.
+  WallClock::time_point __armed_at_; //!< Wall time of the request.
+  SeaplanesTime __requested_time_;   //!< Pending requested time.
+  SeaplanesTime __granted_time_;     //!< Last granted time.
+  unsigned long long __step_number_; //!< Step index of the request.
+
+  std::thread __thread_; //!< Watchdog thread.
+
+  //! \brief Watchdog thread loop.
+  void watch();
+
+  //! \brief Watchdog constructor, private to use the factory builder.
+  //! \param federate_name The name of the watched federate.
+  //! \param threshold The threshold, in seconds of wall time.
+  Watchdog(Name /* federate_name */, double /* threshold */);
+};
+
+} // namespace Seaplanes
+
+#endif // LOGICALPROCESSORWATCHDOG_H
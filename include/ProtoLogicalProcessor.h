@@ -12,21 +12,30 @@
 #include <map>
 #include <vector>
 
+#include <LogicalProcessorAllocation.h>
+#include <LogicalProcessorAllocationCounter.h>
 #include <LogicalProcessorCommon.h>
+#include <LogicalProcessorExecutor.h>
+#include <LogicalProcessorInteraction.h>
+#include <LogicalProcessorInteractionClass.h>
+#include <LogicalProcessorIoThread.h>
 #include <LogicalProcessorLogger.h>
+#include <LogicalProcessorMetrics.h>
+#include <LogicalProcessorModelScheduler.h>
 #include <LogicalProcessorObjectClass.h>
 #include <LogicalProcessorObjectInstancePublished.h>
 #include <LogicalProcessorObjectInstanceSubscribed.h>
+#include <LogicalProcessorPlacement.h>
+#include <LogicalProcessorStateSaver.h>
+#include <LogicalProcessorStatistics.h>
+#include <LogicalProcessorWatchdog.h>
 #include <SeaplanesTime.h>
 #include <TimeManagementPolicyFactory.h>
 
 namespace Seaplanes {
 
-//! \brief Type for tag unique pointer.
-using UpTag = std::unique_ptr<Tag>;
-
-//! \brief Type for tag unique pointer vector.
-using VecUpTag = std::vector<UpTag>;
+//! \brief Type for tag vector.
+using VecTag = std::vector<Tag>;
 
 //! \brief Type for vector of object shared pointers.
 using VecSpObject = std::vector<SpObject>;
@@ -42,9 +51,26 @@ using VecSpObjectInstanceSubscribed = std::vector<SpObjectInstanceSubscribed>;
 using MapHandleSpObjectInstanceSubscribed =
     std::map<RTI::ObjectHandle, SpObjectInstanceSubscribed>;
 
+//! \brief Type for multimap of name <-> object instance subscribed shared
+//! pointers.
+using MultimapNameSpObjectInstanceSubscribed =
+    std::multimap<Name, SpObjectInstanceSubscribed>;
+
 //! \brief Type for object instance published unique pointers vector.
 using VecUpObjectInstancePublished = std::vector<UpObjectInstancePublished>;
 
+//! \brief Type for vector of interaction class shared pointers.
+using VecSpInteractionClass = std::vector<SpInteractionClass>;
+
+//! \brief Type for map of interaction class handle <-> interaction class
+//! shared pointer.
+using MapHandleSpInteractionClass =
+    std::map<RTI::InteractionClassHandle, SpInteractionClass>;
+
+//! \brief Type for parameters set unique pointer.
+using UpRTIParameterHandleValuePairSet =
+    std::unique_ptr<RTI::ParameterHandleValuePairSet>;
+
 //! \brief Common interface to federates.
 class ProtoLogicalProcessor : public NullFederateAmbassador {
 public:
@@ -95,6 +121,76 @@ public:
   //! \return
   SeaplanesTime getTimeStep() const;
 
+  //! \brief Get the lookahead, added to the local time to stamp the updates.
+  //! \return The lookahead.
+  SeaplanesTime getLookahead() const;
+
+  //! \brief Get the sub-step, the time step divided by the number of
+  //! sub-steps, to integrate over in the local calculation.
+  //! \return The duration of a sub-step.
+  SeaplanesTime getSubStep() const;
+
+  //! \brief Get the index of the sub-step being computed in the time step.
+  //! \return The sub-step index, zero without sub-steps.
+  unsigned int getSubStepIndex() const;
+
+  //! \brief Get time limit.
+  //! \return The time limit of the simulation.
+  SeaplanesTime getTimeLimit() const;
+
+  //! \brief Get the last granted time. Equal to the local time, unless the
+  //! time management policy runs ahead of the grants.
+  //! \return The last granted time.
+  SeaplanesTime getGrantedTime() const;
+
+  //! \brief Set the local time, for time management policies running ahead of
+  //! the grants.
+  //! \param time The new local time.
+  void setLocalTime(SeaplanesTime /* time */);
+
+  //! \brief Set the current step index, when rolling back.
+  //! \param step_number The step index.
+  void setStepNumber(unsigned long long /* step_number */);
+
+  //! \brief Get all the attributes of the published and subscribed object
+  //! instances.
+  //! \return The attributes.
+  VecSpAttribute getAttributes() const;
+
+  //! \brief Get the struct-of-arrays stores of the published and subscribed
+  //! object instances, each store once.
+  //! \return The stores.
+  VecSpObjectClassStore getStores() const;
+
+  //! \brief Get the retraction handles of the updates sent at the last step.
+  //! \return The retraction handles.
+  const VecEventRetractionHandle &getSentRetractionHandles() const;
+
+  //! \brief Get the blocked and compute time statistics.
+  //! \return The statistics.
+  const Statistics &getStatistics() const;
+
+  //! \brief Save the federate state, at each step when rollbacks are
+  //! possible. To be specialized by federates holding state outside
+  //! attributes.
+  //! \param time The local time of the saved state.
+  virtual void saveState(SeaplanesTime /* time */);
+
+  //! \brief Restore the federate state saved at a time, discarding newer ones.
+  //! \param time The local time of the state to restore.
+  virtual void restoreState(SeaplanesTime /* time */);
+
+  //! \brief Discard the federate states saved before a time, that will never
+  //! be restored.
+  //! \param time The oldest time that can still be restored.
+  virtual void discardState(SeaplanesTime /* time */);
+
+  //! \brief Get the error estimate of the step just computed, for adaptive
+  //! steps. The largest estimate of the models by default, to be specialized
+  //! by federates computing outside models.
+  //! \return The error estimate, zero if none.
+  virtual double getErrorEstimate() const;
+
   //! \brief Get if asking time regulator or not.
   //! \return True if asking for time regulator.
   bool getAskTimeRegulator() const;
@@ -125,6 +221,21 @@ public:
   //! \param  dt the delta of time for next step.
   void timeAdvanceRequest(SeaplanesTime /* dt */);
 
+  //! \brief FQR, delivers all the queued messages without waiting. Grant is
+  //! notified through the time advance grant flag.
+  //! \param time The time to flush the queue up to.
+  void flushQueueRequest(SeaplanesTime /* time */);
+
+  //! \brief Process the available RTI callbacks, without blocking.
+  void tick();
+
+  //! \brief Wait for and process RTI callbacks.
+  void tick2();
+
+  //! \brief Retract a sent message.
+  //! \param event_retraction_handle The handle of the message.
+  void retract(RTI::EventRetractionHandle /* event_retraction_handle */);
+
   //! \brief Discover object instance.
   //! \param object_handle The object handle.
   //! \param object_class_handle The class of the object.
@@ -154,6 +265,58 @@ public:
       const RTI::FedTime & /* time */, const char /* tag */[],
       RTI::EventRetractionHandle /* event_retraction_handle */) noexcept final;
 
+  //! \brief Receive interaction.
+  //! \param handle The interaction class handle.
+  //! \param parameters The parameters of the interaction.
+  //! \param tag A TAG.
+  void receiveInteraction(
+      RTI::InteractionClassHandle /* handle */,
+      const RTI::ParameterHandleValuePairSet & /* parameters */,
+      const char /* tag */[]) noexcept final;
+
+  //! \brief Receive interaction.
+  //! \param handle The interaction class handle.
+  //! \param parameters The parameters of the interaction.
+  //! \param time Fedtime.
+  //! \param tag A TAG.
+  //! \param event_retraction_handle An handle for event reaction.
+  void receiveInteraction(
+      RTI::InteractionClassHandle /* handle */,
+      const RTI::ParameterHandleValuePairSet & /* parameters */,
+      const RTI::FedTime & /* time */, const char /* tag */[],
+      RTI::EventRetractionHandle /* event_retraction_handle */) noexcept final;
+
+  //! \brief Retraction of an already received message.
+  //! \param event_retraction_handle The handle of the retracted message.
+  void requestRetraction(
+      RTI::EventRetractionHandle /* event_retraction_handle */) noexcept final;
+
+  //! \brief Class relevance advisory, some federate subscribes to the class.
+  //! \param object_class_handle The object class handle.
+  void startRegistrationForObjectClass(
+      RTI::ObjectClassHandle /* object_class_handle */) noexcept final;
+
+  //! \brief Class relevance advisory, no federate subscribes to the class.
+  //! \param object_class_handle The object class handle.
+  void stopRegistrationForObjectClass(
+      RTI::ObjectClassHandle /* object_class_handle */) noexcept final;
+
+  //! \brief Attribute relevance advisory, some federate subscribes to the
+  //! attributes of the object instance.
+  //! \param object_handle The object handle.
+  //! \param attributes The attributes handles.
+  void turnUpdatesOnForObjectInstance(
+      RTI::ObjectHandle /* object_handle */,
+      const RTI::AttributeHandleSet & /* attributes */) noexcept final;
+
+  //! \brief Attribute relevance advisory, no federate subscribes to the
+  //! attributes of the object instance anymore.
+  //! \param object_handle The object handle.
+  //! \param attributes The attributes handles.
+  void turnUpdatesOffForObjectInstance(
+      RTI::ObjectHandle /* object_handle */,
+      const RTI::AttributeHandleSet & /* attributes */) noexcept final;
+
   //! \brief Time regulation callback.
   //! \param time The time.
   void timeRegulationEnabled(const RTI::FedTime & /* time */) noexcept final;
@@ -218,6 +381,98 @@ protected:
   //! \param sp_instance The object instance.
   void addSubscribedObject(SpObjectInstanceSubscribed /* sp_instance */);
 
+  //! \brief Add an interaction class to publish.
+  //! \param sp_interaction_class The interaction class.
+  void addPublishedInteraction(SpInteractionClass /* sp_interaction_class */);
+
+  //! \brief Add an interaction class to subscribe, not supported by the
+  //! optimistic time management policy, \see initializingTimeManagementPolicy.
+  //! \param sp_interaction_class The interaction class.
+  void addSubscribedInteraction(SpInteractionClass /* sp_interaction_class */);
+
+  //! \brief Send an interaction, queued and sent with the updates of the step,
+  //! at the same time stamp.
+  //! \param interaction The interaction, of a published interaction class.
+  //! \throw std::invalid_argument If the interaction class is not published.
+  void sendInteraction(const Interaction & /* interaction */);
+
+  //! \brief Get the number of interactions received for the step, during the
+  //! last time advance.
+  //! \return The number of interactions received.
+  std::size_t getReceivedInteractionsNumber() const;
+
+  //! \brief Get an interaction received for the step, in reception order.
+  //! \param index The index of the interaction.
+  //! \return The interaction.
+  const Interaction &getReceivedInteraction(std::size_t /* index */) const;
+
+  //! \brief Add a model, run by the default local calculation in the order of
+  //! the dependencies between its ports and the ports of the other models.
+  //! With an allocation, only the models allocated to the LP are kept.
+  //! \param sp_model The model.
+  void addModel(SpModel /* sp_model */);
+
+  //! \brief Read the allocation of the models to the LPs and cores, computed
+  //! by the seaplanes-allocator tool. The simulation thread is pinned to the
+  //! CPU of the LP, and only its models are kept. To be called from the
+  //! federate constructor, before adding the models.
+  //! \param path The path of the allocation file.
+  //! \throw std::logic_error If models are already added.
+  //! \throw std::invalid_argument If the LP is not in the allocation.
+  //! \throw std::runtime_error If the allocation cannot be read.
+  void setAllocation(const Name & /* path */);
+
+  //! \brief Measure the compute time of the models, and write their profile
+  //! at the end of the simulation, for the seaplanes-allocator tool. The
+  //! models are measured when run sequentially only. To be called from the
+  //! federate constructor.
+  //! \param path The path of the models profile file.
+  void setModelsProfile(const Name & /* path */);
+
+  //! \brief Run the independent models of a step in parallel. To be called
+  //! from the federate constructor.
+  //! \param threads_number The number of threads, the simulation thread
+  //! included, 0 for the number of hardware threads.
+  //! \param deterministic True for models reading delayed inputs to wait for
+  //! the models writing them as in the sequential execution, for models
+  //! sharing state out of their ports. Delayed inputs are snapshots, their
+  //! values do not depend on the mode.
+  void setModelsThreads(unsigned int /* threads_number */,
+                        bool /* deterministic */ = false);
+
+  //! \brief Tick the RTI and decode the reflections on a dedicated thread
+  //! during the simulation loop, the reflections being reflected at the
+  //! updates reception. Not available with the optimistic policy. To be
+  //! called from the federate constructor.
+  //! \param tick_time The time waited for messages by a tick, in seconds, the
+  //! longest the simulation thread waits to use the RTI.
+  void enableIoThread(double /* tick_time */ = 1e-4);
+
+  //! \brief Expose the live metrics of the LP in a shared memory segment,
+  //! written at each step, for the seaplanes-top tool or dashboards. To be
+  //! called from the federate constructor.
+  //! \throw std::system_error If the segment cannot be created.
+  void enableMetrics();
+
+  //! \brief Set the longest time waited for the discovery of the subscribed
+  //! object instances, at the initialization. The instances not discovered
+  //! by then are reported. To be called from the federate constructor.
+  //! \param timeout The timeout in seconds, zero to wait without limit.
+  void setDiscoveryTimeout(double /* timeout */);
+
+  //! \brief Run the local calculation several times per time step, at the
+  //! sub-step times, while the updates are received, sent, and the time
+  //! advanced once per time step. Received values are held across the
+  //! sub-steps, or extrapolated to their times when an extrapolation is set.
+  //! To be called from the federate constructor.
+  //! \param sub_steps_number The number of sub-steps per time step.
+  //! \throw std::invalid_argument If the time step, in microseconds, is not
+  //! a multiple of the number of sub-steps.
+  //! \throw std::logic_error With the adaptive time management policy, whose
+  //! steps are not the time step. The policy set after the sub-steps is
+  //! refused at the initialization.
+  void setSubSteps(unsigned int /* sub_steps_number */);
+
   //! \brief The creation phase function.
   void creationPhase();
 
@@ -229,6 +484,10 @@ protected:
   //! Seaplanes::ProtoLogicalProcessor::creationPhase.
   void federationJoin();
 
+  //! \brief Apply and report the simulation thread and RTIA placement. \see
+  //! Seaplanes::ProtoLogicalProcessor::creationPhase.
+  void threadsPlacement();
+
   //! \brief Initialize the federation.
   virtual void initializationPhase();
 
@@ -236,12 +495,22 @@ protected:
   //! Seaplanes::ProtoLogicalProcessor::initializationPhase
   void attributesAndObjectsHandlesFetching();
 
+  //! \brief Create the DDM regions of the object instances. \see
+  //! Seaplanes::ProtoLogicalProcessor::attributesAndObjectsHandlesFetching
+  void regionsCreation();
+
+  //! \brief Order the models from their ports. \see
+  //! Seaplanes::ProtoLogicalProcessor::initializationPhase
+  void modelsOrdering();
+
   //! \brief Declare publication and subscription. \see
   //! Seaplanes::ProtoLogicalProcessor::initializationPhase
   void declarationOfPublicationAndSubscription();
 
   //! \brief Initialize time managemeent policy. \see
   //! Seaplanes::ProtoLogicalProcessor::initializationPhase
+  //! \throw std::logic_error If interactions are subscribed, or attributes
+  //! published in receive order, with the optimistic time management policy.
   void initializingTimeManagementPolicy();
 
   //! \brief Synchronization. \see
@@ -252,6 +521,12 @@ protected:
   //! Seaplanes::ProtoLogicalProcessor::initializationPhase
   void registeringObjects();
 
+  //! \brief Wait at once for the discovery of all the subscribed object
+  //! instances, until the discovery timeout. \see
+  //! Seaplanes::ProtoLogicalProcessor::registeringObjects
+  //! \throw std::runtime_error If some are not discovered, naming them.
+  void discoveryWaiting();
+
   //! \brief Simulation loop.
   void simulationLoopPhase();
 
@@ -259,21 +534,44 @@ protected:
   //! Seaplanes::ProtoLogicalProcessor::simulationLoopPhase
   void timeAdvance();
 
-  //! \brief Update recepted values. \see
-  //! Seaplanes::ProtoLogicalProcessor::simulationLoopPhase
+  //! \brief Update recepted values, swapping the subscribed object instances
+  //! buffers. \see Seaplanes::ProtoLogicalProcessor::simulationLoopPhase
   void updatesReception();
 
-  //! \brief Local core calculation. \see
+  //! \brief Local core calculation, running the models by default. \see
   //! Seaplanes::ProtoLogicalProcessor::simulationLoopPhase
-  virtual void localsCalculation() = 0;
+  virtual void localsCalculation();
+
+  //! \brief Run the local calculation at each sub-step of the time step.
+  //! \see Seaplanes::ProtoLogicalProcessor::simulationLoopPhase
+  void subStepsCalculation();
 
   //! \brief Update the values and send them. \see
   //! Seaplanes::ProtoLogicalProcessor::simulationLoopPhase
   void updatesSending();
 
+  //! \brief Send the interactions queued during the step. \see
+  //! Seaplanes::ProtoLogicalProcessor::updatesSending
+  //! \param time The time stamp of the interactions.
+  void interactionsSending(const RTIfedTime & /* time */);
+
   //! \brief Ending.
   void endingPhase();
 
+  //! \brief Log the staleness of the subscribed attributes read as samples,
+  //! by the models ports included, to find the inputs read more often than
+  //! updated. \see
+  //! Seaplanes::ProtoLogicalProcessor::endingPhase
+  void stalenessLogging();
+
+  //! \brief Log the sent and suppressed updates of the published attributes
+  //! with update policies. \see Seaplanes::ProtoLogicalProcessor::endingPhase
+  void updatePoliciesLogging();
+
+  //! \brief Write the profile of the models, their compute times, periods
+  //! and ports. \see Seaplanes::ProtoLogicalProcessor::endingPhase
+  void modelsProfileWriting();
+
   //! \brief Deleting registration. \see
   //! Seaplanes::ProtoLogicalProcessor::endingPhase
   void deletingRegisteredObjects();
@@ -299,6 +597,11 @@ protected:
   //! \brief Log activity after local calculation.
   void logPostLocalsCalculation();
 
+  //! \brief Check no allocation happened during a step, once warmed up, when
+  //! counting allocations.
+  //! \param allocations The number of allocations at the start of the step.
+  void allocationsCheck(unsigned long long /* allocations */);
+
   //! \brief Print a progression bar.
   void printProgression() const;
 
@@ -385,7 +688,105 @@ protected:
   //! \return The step index
   unsigned long long getStepNumber() const;
 
+  //! \brief Replace the time management policy, before running.
+  //! \template class T The type of time management policy. \see Time management
+  //! policies.
+  //! \return A reference to the new time management policy, for configuration.
+  template <class T> T &setTimeManagementPolicy();
+
+  //! \brief Pin the simulation loop thread to CPUs. To be called from the
+  //! federate constructor before creating attributes, so they are allocated on
+  //! the local NUMA node.
+  //! \param cpus The CPU set.
+  //! \throw std::invalid_argument If a CPU is out of the CPU sets range.
+  void setSimulationAffinity(CpuSet /* cpus */);
+
+  //! \brief Pin the RTIA process of the LP to CPUs.
+  //! \param cpus The CPU set.
+  //! \throw std::invalid_argument If a CPU is out of the CPU sets range.
+  void setRtiaAffinity(CpuSet /* cpus */);
+
+  //! \brief Log a diagnostic each time a time advance request stays pending
+  //! longer than a threshold.
+  //! \param threshold The threshold, in seconds of wall time, 0 to disable.
+  void setStallThreshold(double /* threshold */);
+
+  //! \brief Follow the relevance advisories of the RTI, and only send the
+  //! attributes some federate subscribes to. To be called from the federate
+  //! constructor.
+  void enableRelevanceAdvisories();
+
+  //! \brief Set the number of steps before checking the simulation loop does
+  //! not allocate, when built with the allocation counter.
+  //! \param steps The number of warm up steps.
+  void setAllocationWarmupSteps(unsigned long long /* steps */);
+
+  //! \brief Publish the blocked and compute time statistics at each step, as
+  //! an instance of a management object class, so a monitor can find the
+  //! federate holding the federation back. The class must be declared in the
+  //! FOM, with the lastBlockedTime, lastComputeTime, totalBlockedTime and
+  //! totalComputeTime attributes (seconds). To be called from the federate
+  //! constructor.
+  //! \param class_name The name of the management object class.
+  void enableStatisticsPublication(Name /* class_name */ = "Statistics");
+
+  //! \brief Update the published statistics. \see
+  //! Seaplanes::ProtoLogicalProcessor::updatesSending
+  void statisticsUpdate();
+
+  //! \brief Write the live metrics of the step, if enabled. \see
+  //! Seaplanes::ProtoLogicalProcessor::simulationLoopPhase
+  void metricsPublishing();
+
+  //! \brief Notify the RTI of the DDM regions moved during the step. \see
+  //! Seaplanes::ProtoLogicalProcessor::updatesSending
+  void regionsModification();
+
 private:
+  //! The optimistic policy drives the grants and step index itself, and
+  //! ticks the RTI without I/O thread.
+  friend class TimeManagementPolicyOptimistic;
+
+  //! \brief Start accounting a wait for a grant, and arm the watchdog.
+  //! \param requested_time The time requested.
+  void blockingStart(SeaplanesTime /* requested_time */);
+
+  //! \brief Stop accounting a wait for a grant, and disarm the watchdog.
+  void blockingStop();
+
+  //! \brief Discard the time stamped values received and not swapped yet, on
+  //! rollbacks, the input log replaying them. The values received in order,
+  //! not logged, are kept.
+  void reflectionsDiscarding();
+
+  //! \brief Account for received values in the live metrics, if enabled.
+  //! \param values The values.
+  void receptionCounting(const RTI::AttributeHandleValuePairSet & /* values */);
+
+  //! \brief Account for received parameters in the live metrics, if enabled.
+  //! \param parameters The parameters.
+  void receptionCounting(
+      const RTI::ParameterHandleValuePairSet & /* parameters */);
+
+  //! \brief Queue an interaction received for the next step.
+  //! \param handle The interaction class handle.
+  //! \param parameters The parameters of the interaction.
+  //! \param time The time stamp of the interaction.
+  void interactionReception(
+      RTI::InteractionClassHandle /* handle */,
+      const RTI::ParameterHandleValuePairSet & /* parameters */,
+      SeaplanesTime /* time */);
+
+  //! \brief Reflect values into the subscribed object instance.
+  //! \param handle The object instance handle.
+  //! \param values The values.
+  //! \param time The time stamp of the reflection.
+  //! \param time_stamped True if the reflection is time stamped, false if
+  //! received in order.
+  void reflection(RTI::ObjectHandle /* handle */,
+                  const RTI::AttributeHandleValuePairSet & /* values */,
+                  SeaplanesTime /* time */, bool /* time_stamped */ = true);
+
   Name __synchro_point_name_; //!< The name of the synchronization point.
   Name __federation_name_;    //!< The name of the federation.
   Name __federate_name_;      //!< The name of the federate.
@@ -408,20 +809,60 @@ private:
   bool __has_time_advance_grant_; //!< True if the Federate has time advance
                                   //!< grant, else False.
 
-  SeaplanesTime __local_time_; //!< Current time of the federate.
-  SeaplanesTime __time_step_;  //!< Duration of a timeStep.
-  SeaplanesTime __lookahead_;  //!< Duration of the lookahead.
-  SeaplanesTime __time_limit_; //!< Time limit.
+  SeaplanesTime __local_time_;   //!< Current time of the federate.
+  SeaplanesTime __granted_time_; //!< Last granted time.
+  SeaplanesTime __time_step_;    //!< Duration of a timeStep.
+  SeaplanesTime __lookahead_;    //!< Duration of the lookahead.
+  SeaplanesTime __time_limit_;   //!< Time limit.
 
   bool __is_creator_; //!< True if the Federate is creator, else False.
 
   unsigned long long __step_number_; //!< Current step index.
 
+  unsigned int __sub_steps_number_; //!< Number of sub-steps per time step.
+  unsigned int __sub_step_index_;   //!< Current sub-step index.
+
   //! Federate synchronization attributes
   bool __sync_reg_success_; //!< True if registration is OK, else false.
   bool __sync_reg_failed_;  //!< True if registration failed, else false.
   bool __in_pause_;         //!< True if in pause, else false.
 
+  //! Simulation thread and RTIA placement.
+  Placement __placement_;
+
+  //! Blocked and compute time statistics.
+  Statistics __statistics_;
+
+  //! Time advance watchdog, null if disabled.
+  UpWatchdog __up_watchdog_;
+
+  //! True if following the relevance advisories.
+  bool __relevance_advisories_;
+
+  //! Published statistics attributes, empty if not published.
+  VecSpAttribute __sp_statistics_attributes_;
+
+  //! Models of the LP, run in dependency order.
+  ModelScheduler __model_scheduler_;
+
+  //! Parallel models execution, null if sequential.
+  UpExecutor __up_executor_;
+
+  bool __io_thread_enabled_; //!< True to run an I/O thread.
+  double __io_tick_time_;    //!< Time waited for messages by an I/O tick.
+
+  //! RTI I/O thread, running during the simulation loop only.
+  UpIoThread __up_io_thread_;
+
+  //! Live metrics, null if disabled.
+  UpMetrics __up_metrics_;
+
+  //! Allocation of the models to the LPs, null if none.
+  UpAllocation __up_allocation_;
+
+  //! Path of the models profile written at the end, empty if none.
+  Name __models_profile_path_;
+
   //! The strategy for time managemeent policy.
   UpITimeManagementPolicy __up_time_management_policy_;
 
@@ -431,7 +872,18 @@ private:
   Logger &__logger_;
 
   unsigned int __uav_index_; //!< Index of UAV for context.
-  VecUpTag __up_rav_tags_;   //!< Index of RAVs for context.
+
+  //! Retraction handles of the updates sent at the last step.
+  VecEventRetractionHandle __sent_retraction_handles_;
+
+  Tag __uav_tag_; //!< Tag of the UAVs, reused at each step.
+
+  //! Tags of the RAVs for context, reused from step to step.
+  VecTag __rav_tags_;
+  std::size_t __rav_tags_number_; //!< Number of RAVs tags of the step.
+
+  //! Steps before checking the loop does not allocate, in test mode.
+  unsigned long long __allocation_warmup_steps_;
 
   //! Vector of object classes. \see Object.
   VecSpObject __sp_object_classes_;
@@ -445,9 +897,45 @@ private:
   //! Map on subscribedObjects for better access to subscribed objects.
   MapHandleSpObjectInstanceSubscribed __map_sp_subscribed_objects_;
 
+  //! Subscribed object instances not discovered yet, by name.
+  MultimapNameSpObjectInstanceSubscribed __map_undiscovered_objects_;
+
+  //! Longest time waited for the discoveries, in seconds, zero for no limit.
+  double __discovery_timeout_;
+
+  //! Published interaction classes.
+  VecSpInteractionClass __sp_published_interactions_;
+
+  //! Subscribed interaction classes.
+  VecSpInteractionClass __sp_subscribed_interactions_;
+
+  //! Subscribed interaction classes, by handle.
+  MapHandleSpInteractionClass __map_sp_subscribed_interactions_;
+
+  //! Interactions to send at the step, reused from step to step.
+  VecInteraction __interactions_to_send_;
+  std::size_t __interactions_to_send_number_; //!< Interactions to send.
+
+  //! Interactions received for the step, reused from step to step.
+  VecInteraction __received_interactions_;
+  std::size_t __received_interactions_number_; //!< Interactions received.
+
+  //! Interactions received for the next step, possibly from the I/O thread.
+  VecInteraction __incoming_interactions_;
+  std::size_t __incoming_interactions_number_; //!< Interactions incoming.
+
+  //! Parameters of the interactions to send.
+  UpRTIParameterHandleValuePairSet __up_parameters_;
+
+  //! Encoded values of the parameters of the interactions to send.
+  std::vector<unsigned char> __encoded_parameters_;
+
   std::time_t __timer_simu_start_; //!< Timer set when simulation start.
   std::time_t __timer_simu_end_;   //!< Time set when simulation end.
 };
+
+#include <ProtoLogicalProcessor.tcc>
+
 } // namespace Seaplanes
 
 #endif // PROTOLOGICALPROCESSOR_H
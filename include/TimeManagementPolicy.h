@@ -51,6 +51,17 @@ public:
   //! \brief Access logical processor.
   auto getLP() -> ProtoLogicalProcessor & final;
 
+  //! \brief Time stamped reflection received by the logical processor.
+  auto reflectionReceived(RTI::ObjectHandle /* object_handle */,
+                          const RTI::AttributeHandleValuePairSet & /* values */,
+                          SeaplanesTime /* time */,
+                          RTI::EventRetractionHandle /* handle */)
+      -> bool final;
+
+  //! \brief Retraction of an already received message requested.
+  auto retractionRequested(RTI::EventRetractionHandle /* handle */)
+      -> void final;
+
 private:
   friend ITimeManagementPolicy;
   friend UpTimeManagementPolicy
@@ -0,0 +1,153 @@
+//! \file    TimeManagementPolicyAdaptive.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Adaptive timestep time management specialization.
+//!
+//! Timestep time management policy where the step of each time advance
+//! request is chosen from the error estimate of the local calculation, \see
+//! ProtoLogicalProcessor::getErrorEstimate. After each step, the next one is
+//! scaled by the ratio of the tolerance over the error, to the power of one
+//! over the order plus one, as integrators control their steps: quiet phases
+//! run at large steps, transients at fine ones. A step over the tolerance is
+//! not computed again, the conservative grants forbidding it, only the next
+//! one is shortened. Steps are kept within bounds, multiples of the minimum
+//! one so that the federates keep a common time grid, and end at the time
+//! limit. They are not shorter than the lookahead either, so the updates of a
+//! step are still reflected at the next one.
+
+#ifndef TIMEMANAGEMENTPOLICYADAPTIVE_H
+#define TIMEMANAGEMENTPOLICYADAPTIVE_H
+
+#include <ITimeManagementPolicy.h>
+#include <TimeManagementPolicy.h>
+
+namespace Seaplanes {
+
+//! \brief Type for TimeManagementPolicyAdaptive unique pointer.
+using UpTimeManagementPolicyAdaptive =
+    std::unique_ptr<class TimeManagementPolicyAdaptive>;
+
+//! \brief Adaptive timestep time management policy.
+class TimeManagementPolicyAdaptive final : public ITimeManagementPolicy {
+public:
+  ~TimeManagementPolicyAdaptive() override = default;
+
+  //! \brief Initializing of time management policy.
+  auto initializing() -> void final;
+
+  //! \brief time advance of time management policy.
+  auto timeAdvance() -> void final;
+
+  //! \brief Deactivating of time management policy.
+  auto deactivating() -> void final;
+
+  //! \brief Set next time for time advancement.
+  auto setDt(SeaplanesTime /* dt */) -> void final;
+
+  //! \brief Access logical processor.
+  auto getLP() -> ProtoLogicalProcessor & final;
+
+  //! \brief Time stamped reflection received by the logical processor.
+  auto reflectionReceived(RTI::ObjectHandle /* object_handle */,
+                          const RTI::AttributeHandleValuePairSet & /* values */,
+                          SeaplanesTime /* time */,
+                          RTI::EventRetractionHandle /* handle */)
+      -> bool final;
+
+  //! \brief Retraction of an already received message requested.
+  auto retractionRequested(RTI::EventRetractionHandle /* handle */)
+      -> void final;
+
+  //! \brief Set the bounds of the steps. Without bounds, the step of the LP
+  //! is kept.
+  //! \param min_step The shortest step, the steps being multiples of it.
+  //! \param max_step The longest step.
+  //! \throw std::invalid_argument If the bounds are empty or null, or the
+  //! longest step is shorter than the lookahead.
+  void setStepBounds(SeaplanesTime /* min_step */,
+                     SeaplanesTime /* max_step */);
+
+  //! \brief Set the error tolerated on a step.
+  //! \param tolerance The error estimate at which the step is kept.
+  void setTolerance(double /* tolerance */);
+
+  //! \brief Set the order of the error estimate, the error of a step being
+  //! proportional to the step to the power of the order plus one.
+  //! \param order The order of the error estimate.
+  void setOrder(unsigned int /* order */);
+
+  //! \brief Get the step being computed, from the local time to the next time
+  //! advance request, to integrate over in the local calculation.
+  //! \return The current step.
+  SeaplanesTime getStep() const;
+
+  //! \brief Number of steps over the tolerance, computed anyway and only
+  //! followed by a shorter step.
+  //! \return The number of steps whose error exceeded the tolerance.
+  unsigned long long getOverToleranceStepsNumber() const;
+
+  //! \brief Factor of the next step over the step computed, from its error
+  //! estimate, within the growth and shrink limits.
+  //! \param error The error estimate of the step computed.
+  //! \param tolerance The error tolerated on a step.
+  //! \param order The order of the error estimate.
+  //! \return The factor of the next step.
+  static double growthFactor(double /* error */, double /* tolerance */,
+                             unsigned int /* order */);
+
+  //! \brief Bound and quantize a step: within the bounds, not shorter than
+  //! the lookahead, a multiple of the shortest step, and ending at the time
+  //! limit.
+  //! \param step The step to bound, in seconds.
+  //! \param min_step The shortest step, and steps quantum.
+  //! \param max_step The longest step.
+  //! \param lookahead The lookahead of the LP.
+  //! \param local_time The local time of the LP.
+  //! \param time_limit The time limit of the simulation.
+  //! \return The bounded step.
+  static SeaplanesTime boundStep(double /* step */,
+                                 SeaplanesTime /* min_step */,
+                                 SeaplanesTime /* max_step */,
+                                 SeaplanesTime /* lookahead */,
+                                 SeaplanesTime /* local_time */,
+                                 SeaplanesTime /* time_limit */);
+
+private:
+  friend ITimeManagementPolicy;
+  friend UpTimeManagementPolicyAdaptive
+  std::make_unique<TimeManagementPolicyAdaptive>(
+      Seaplanes::ProtoLogicalProcessor &);
+
+  UpTimeManagementPolicy
+      __up_time_management_policy_; //!< base time management policy.
+
+  SeaplanesTime __min_step_; //!< Shortest step, and steps quantum.
+  SeaplanesTime __max_step_; //!< Longest step.
+  SeaplanesTime __step_;     //!< Step being computed.
+  double __tolerance_;       //!< Error tolerated on a step.
+  unsigned int __order_;     //!< Order of the error estimate.
+
+  unsigned long long __steps_;                //!< Number of steps.
+  unsigned long long __over_tolerance_steps_; //!< Steps over the tolerance.
+  SeaplanesTime __shortest_step_;             //!< Shortest step taken.
+  SeaplanesTime __longest_step_;              //!< Longest step taken.
+
+  //! \brief Choose the next step from the error estimate of the step.
+  //! \param error The error estimate of the step computed.
+  void nextStep(double /* error */);
+
+  //! \brief Bound and quantize a step, ending at the time limit.
+  //! \param step The step to bound.
+  //! \return The bounded step.
+  SeaplanesTime boundedStep(double /* step */);
+
+  //! \brief TimeManagementPolicyAdaptive constructor, protected so the
+  //! timeManagementPolicies can use it while federates use the factory builder.
+  //! \param lp Reference to the LP concerned by the time management policy.
+  explicit TimeManagementPolicyAdaptive(ProtoLogicalProcessor & /* lp */);
+};
+
+} // namespace Seaplanes
+
+#endif // TIMEMANAGEMENTPOLICYADAPTIVE_H
@@ -0,0 +1,143 @@
+//! \file    TimeManagementPolicyOptimistic.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Optimistic (Time Warp) time management specialization.
+//!
+//! The logical processor runs ahead of its grant, up to a window of steps.
+//! Time stamped messages are obtained with flush queue requests and kept in an
+//! input log, reflected when the local time reaches their time stamps. The
+//! attributes and the struct-of-arrays stores (and the federate state, through
+//! the logical processor state hooks) are saved at each step. When a
+//! straggler, a message time stamped before an already computed step, or a
+//! retraction of an already reflected message is received, the logical
+//! processor rolls back to the step that should have consumed it, and the
+//! updates sent since are retracted. Grants bound the rollbacks, older
+//! checkpoints and inputs are then discarded.
+
+#ifndef TIMEMANAGEMENTPOLICYOPTIMISTIC_H
+#define TIMEMANAGEMENTPOLICYOPTIMISTIC_H
+
+#include <deque>
+
+#include <ITimeManagementPolicy.h>
+#include <LogicalProcessorStateSaver.h>
+#include <TimeManagementPolicy.h>
+
+namespace Seaplanes {
+
+//! \brief Type for TimeManagementPolicyOptimistic unique pointer.
+using UpTimeManagementPolicyOptimistic =
+    std::unique_ptr<class TimeManagementPolicyOptimistic>;
+
+//! \brief Optimistic time management policy.
+class TimeManagementPolicyOptimistic final : public ITimeManagementPolicy {
+public:
+  ~TimeManagementPolicyOptimistic() override = default;
+
+  //! \brief Initializing of time management policy.
+  auto initializing() -> void final;
+
+  //! \brief time advance of time management policy.
+  auto timeAdvance() -> void final;
+
+  //! \brief Deactivating of time management policy.
+  auto deactivating() -> void final;
+
+  //! \brief Set next time for time advancement.
+  auto setDt(SeaplanesTime /* dt */) -> void final;
+
+  //! \brief Access logical processor.
+  auto getLP() -> ProtoLogicalProcessor & final;
+
+  //! \brief Time stamped reflection received by the logical processor, logged
+  //! until the local time reaches it.
+  auto reflectionReceived(RTI::ObjectHandle /* object_handle */,
+                          const RTI::AttributeHandleValuePairSet & /* values */,
+                          SeaplanesTime /* time */,
+                          RTI::EventRetractionHandle /* handle */)
+      -> bool final;
+
+  //! \brief Retraction of an already received message requested.
+  auto retractionRequested(RTI::EventRetractionHandle /* handle */)
+      -> void final;
+
+  //! \brief Set the optimism window.
+  //! \param steps Maximum number of steps ahead of the grant.
+  void setWindow(unsigned int /* steps */);
+
+  //! \brief Number of rollbacks.
+  //! \return The number of rollbacks done.
+  unsigned long long getRollbacksNumber() const;
+
+  //! \brief Number of steps rolled back.
+  //! \return The number of steps undone by rollbacks.
+  unsigned long long getRolledBackStepsNumber() const;
+
+private:
+  friend ITimeManagementPolicy;
+  friend UpTimeManagementPolicyOptimistic
+  std::make_unique<TimeManagementPolicyOptimistic>(
+      Seaplanes::ProtoLogicalProcessor &);
+
+  //! \brief Time stamped input, logged until committed.
+  struct Input {
+    SeaplanesTime time;                        //!< Time stamp.
+    RTI::ObjectHandle object_handle;           //!< Object instance handle.
+    UpRTIAttributeHandleValuePairSet up_values; //!< Copy of the values.
+    RTI::EventRetractionHandle handle;         //!< Retraction handle.
+    bool reflected;                            //!< True once reflected.
+    SeaplanesTime reflected_time; //!< Local time of the reflection.
+  };
+
+  UpTimeManagementPolicy
+      __up_time_management_policy_; //!< base time management policy.
+
+  SeaplanesTime __dt_;          //!< Next time advance.
+  unsigned int __window_;       //!< Maximum number of steps ahead.
+  bool __flush_pending_;        //!< True while a flush queue is pending.
+  bool __rollback_pending_;     //!< True if a rollback is needed.
+  SeaplanesTime __rollback_to_; //!< Earliest time to roll back to.
+
+  StateSaver __state_saver_;  //!< Attributes checkpoints.
+  std::deque<Input> __inputs_; //!< Input log, in reception order.
+
+  unsigned long long __rollbacks_;         //!< Number of rollbacks.
+  unsigned long long __rolled_back_steps_; //!< Number of steps undone.
+
+  //! \brief Save the state at the local time.
+  void checkpoint();
+
+  //! \brief Reflect the logged inputs up to the local time.
+  void reflectInputs();
+
+  //! \brief Request a rollback for a message time stamped at a given time.
+  //! \param time The message time stamp.
+  void requestRollback(SeaplanesTime /* time */);
+
+  //! \brief Roll back to the pending rollback time.
+  void rollback();
+
+  //! \brief Process the callbacks, grants, and bound the optimism.
+  //! \param commit True to wait for the grant of the local time.
+  void synchronize(bool /* commit */);
+
+  //! \brief Discard inputs and checkpoints older than the grant.
+  void fossilCollect();
+
+  //! \brief Compare retraction handles.
+  //! \param lhs A retraction handle.
+  //! \param rhs Another retraction handle.
+  //! \return True if the handles are the same.
+  static bool sameHandle(const RTI::EventRetractionHandle & /* lhs */,
+                         const RTI::EventRetractionHandle & /* rhs */);
+
+  //! \brief TimeManagementPolicyOptimistic constructor, protected so the
+  //! timeManagementPolicies can use it while federates use the factory builder.
+  //! \param lp Reference to the LP concerned by the time management policy.
+  explicit TimeManagementPolicyOptimistic(ProtoLogicalProcessor & /* lp */);
+};
+
+} // namespace Seaplanes
+
+#endif // TIMEMANAGEMENTPOLICYOPTIMISTIC_H
@@ -0,0 +1,152 @@
+//! \file    TimeManagementPolicyRealTime.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Real-time paced time management specialization.
+//!
+//! Timestep time management policy where each granted step is tied to the wall
+//! clock. After each grant, the policy sleeps (absolute deadline on the
+//! monotonic clock) until the wall time corresponding to the new logical time,
+//! scaled by a real-time factor. Deadline misses, wake-up lateness and jitter
+//! are recorded and reported when the policy is deactivated.
+
+#ifndef TIMEMANAGEMENTPOLICYREALTIME_H
+#define TIMEMANAGEMENTPOLICYREALTIME_H
+
+#include <array>
+#include <ctime>
+
+#include <ITimeManagementPolicy.h>
+#include <TimeManagementPolicy.h>
+
+namespace Seaplanes {
+
+//! \brief Type for TimeManagementPolicyRealTime unique pointer.
+using UpTimeManagementPolicyRealTime =
+    std::unique_ptr<class TimeManagementPolicyRealTime>;
+
+//! \brief Statistics on the pacing of the real-time policy.
+//!
+//! Lateness is the time between a step deadline and the moment the step
+//! actually started, in nanoseconds. Histogram bucket i counts the lateness in
+//! [2^(i-1), 2^i[ microseconds, the first bucket counting lateness below 1us
+//! and the last one everything above.
+struct RealTimeStatistics final {
+  //! Number of buckets of the lateness histogram.
+  static constexpr auto histogram_size = 20U;
+
+  unsigned long long steps{0};    //!< Number of paced steps.
+  unsigned long long overruns{0}; //!< Steps granted after their deadline.
+  long long max_lateness_ns{0};   //!< Worst lateness observed.
+  long long min_lateness_ns{0};   //!< Best lateness observed.
+  double sum_lateness_ns{0.};     //!< Sum of lateness, for the mean.
+  double sum_sq_lateness_ns{0.};  //!< Sum of squared lateness, for jitter.
+
+  //! Lateness histogram, power of two buckets in microseconds.
+  std::array<unsigned long long, histogram_size> histogram{{}};
+
+  //! \brief Account a new step lateness.
+  //! \param lateness_ns The lateness of the step, in nanoseconds.
+  //! \param overrun True if the deadline was already missed before sleeping.
+  void record(long long /* lateness_ns */, bool /* overrun */);
+
+  //! \brief Mean lateness.
+  //! \return The mean lateness in nanoseconds.
+  double getMeanLatenessNs() const;
+
+  //! \brief Jitter, as the standard deviation of the lateness.
+  //! \return The jitter in nanoseconds.
+  double getJitterNs() const;
+};
+
+//! \brief Real-time paced time management policy.
+class TimeManagementPolicyRealTime final : public ITimeManagementPolicy {
+public:
+  ~TimeManagementPolicyRealTime() override = default;
+
+  //! \brief Initializing of time management policy.
+  auto initializing() -> void final;
+
+  //! \brief time advance of time management policy.
+  auto timeAdvance() -> void final;
+
+  //! \brief Deactivating of time management policy.
+  auto deactivating() -> void final;
+
+  //! \brief Set next time for time advancement.
+  auto setDt(SeaplanesTime /* dt */) -> void final;
+
+  //! \brief Access logical processor.
+  auto getLP() -> ProtoLogicalProcessor & final;
+
+  //! \brief Time stamped reflection received by the logical processor.
+  auto reflectionReceived(RTI::ObjectHandle /* object_handle */,
+                          const RTI::AttributeHandleValuePairSet & /* values */,
+                          SeaplanesTime /* time */,
+                          RTI::EventRetractionHandle /* handle */)
+      -> bool final;
+
+  //! \brief Retraction of an already received message requested.
+  auto retractionRequested(RTI::EventRetractionHandle /* handle */)
+      -> void final;
+
+  //! \brief Set the real-time factor.
+  //! \param factor Ratio of logical time over wall time. 1 is real time, 2 is
+  //! twice as fast as real time.
+  //! \throw std::invalid_argument If the factor is not positive.
+  void setRealTimeFactor(double /* factor */);
+
+  //! \brief Get the real-time factor.
+  //! \return The ratio of logical time over wall time.
+  double getRealTimeFactor() const;
+
+  //! \brief Lock current and future memory pages and prefault the stack during
+  //! initialization.
+  //! \param lock_memory True to lock memory.
+  void setLockMemory(bool /* lock_memory */);
+
+  //! \brief Use SCHED_FIFO scheduling for the simulation thread.
+  //! \param priority The SCHED_FIFO priority, 0 to keep the default policy.
+  void setSchedulingPriority(int /* priority */);
+
+  //! \brief Pacing statistics getter.
+  //! \return The statistics recorded so far.
+  const RealTimeStatistics &getStatistics() const;
+
+private:
+  friend ITimeManagementPolicy;
+  friend UpTimeManagementPolicyRealTime
+  std::make_unique<TimeManagementPolicyRealTime>(
+      Seaplanes::ProtoLogicalProcessor &);
+
+  UpTimeManagementPolicy
+      __up_time_management_policy_; //!< base time management policy.
+
+  double __real_time_factor_; //!< Logical time over wall time ratio.
+  bool __lock_memory_;        //!< True to mlockall and prefault.
+  int __scheduling_priority_; //!< SCHED_FIFO priority, 0 if unused.
+
+  bool __anchored_;               //!< True once the wall clock origin is set.
+  struct timespec __wall_origin_; //!< Wall time of the logical origin.
+  SeaplanesTime __logical_origin_; //!< Logical time of the wall origin.
+
+  RealTimeStatistics __statistics_; //!< Pacing statistics.
+
+  //! \brief Apply memory locking and scheduling settings.
+  void applyRealTimeSettings();
+
+  //! \brief Sleep until the wall time of the current logical time.
+  void waitDeadline();
+
+  //! \brief Log pacing statistics.
+  void logStatistics() const;
+
+  //! \brief TimeManagementPolicyRealTime constructor, protected so the
+  //! timeManagementPolicies can use it while federates use the factory builder.
+  //! \param lp Reference to the LP concerned by the time management policy.
+  explicit TimeManagementPolicyRealTime(ProtoLogicalProcessor & /* lp */);
+};
+
+} // namespace Seaplanes
+
+#endif // TIMEMANAGEMENTPOLICYREALTIME_H
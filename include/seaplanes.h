@@ -6,16 +6,38 @@
 #define SEAPLANES_SEAPLANES_H
 
 #include <ITimeManagementPolicy.h>
+#include <LogicalProcessorAllocation.h>
+#include <LogicalProcessorAllocationCounter.h>
 #include <LogicalProcessorAttribute.h>
+#include <LogicalProcessorByteOrder.h>
 #include <LogicalProcessorCommon.h>
+#include <LogicalProcessorExecutor.h>
+#include <LogicalProcessorExtrapolator.h>
+#include <LogicalProcessorFomClass.h>
+#include <LogicalProcessorInteraction.h>
+#include <LogicalProcessorInteractionClass.h>
+#include <LogicalProcessorIoThread.h>
 #include <LogicalProcessorLogger.h>
+#include <LogicalProcessorMetrics.h>
+#include <LogicalProcessorModel.h>
+#include <LogicalProcessorModelScheduler.h>
 #include <LogicalProcessorObjectClass.h>
+#include <LogicalProcessorObjectClassStore.h>
 #include <LogicalProcessorObjectInstance.h>
 #include <LogicalProcessorObjectInstancePublished.h>
 #include <LogicalProcessorObjectInstanceSubscribed.h>
+#include <LogicalProcessorPlacement.h>
+#include <LogicalProcessorRegion.h>
+#include <LogicalProcessorStateSaver.h>
+#include <LogicalProcessorStatistics.h>
+#include <LogicalProcessorUpdatePolicy.h>
+#include <LogicalProcessorWatchdog.h>
 #include <ProtoLogicalProcessor.h>
 #include <SeaplanesTime.h>
+#include <TimeManagementPolicyAdaptive.h>
 #include <TimeManagementPolicyFactory.h>
+#include <TimeManagementPolicyOptimistic.h>
+#include <TimeManagementPolicyRealTime.h>
 #include <TimeManagementPolicyTimeStep.h>
 
 #endif // SEAPLANES_SEAPLANES_H
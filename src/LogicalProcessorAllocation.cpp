@@ -0,0 +1,112 @@
+//! \file    LogicalProcessorAllocation.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Allocation of the models to the logical processors and cores
+//! implementation.
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <LogicalProcessorAllocation.h>
+
+using std::move;
+using std::string;
+using std::to_string;
+
+namespace Seaplanes {
+
+namespace {
+
+//! Keyword of the logical processors lines.
+constexpr const char *lp_keyword = "lp";
+
+//! CPU of the logical processors not pinned.
+constexpr const char *no_cpu = "-";
+
+} // namespace
+
+UpAllocation Allocation::create(const Name &path) {
+  std::ifstream file(path);
+  if (!file) {
+    throw std::runtime_error("Cannot read allocation " + path);
+  }
+
+  VecPartition partitions;
+  string line;
+  for (auto line_number = 1U; std::getline(file, line); ++line_number) {
+    line = line.substr(0, line.find('#'));
+    std::istringstream stream(line);
+    string keyword;
+    if (!(stream >> keyword)) {
+      continue;
+    }
+
+    Partition partition{Name(), -1, std::vector<Name>()};
+    string cpu;
+    if (keyword != lp_keyword || !(stream >> partition.lp_name >> cpu)) {
+      throw std::runtime_error("Malformed allocation " + path + ":" +
+                               to_string(line_number));
+    }
+    if (cpu != no_cpu) {
+      try {
+        partition.cpu = std::stoi(cpu);
+      } catch (const std::logic_error &) {
+        throw std::runtime_error("Malformed CPU in allocation " + path + ":" +
+                                 to_string(line_number));
+      }
+    }
+    for (Name model; stream >> model;) {
+      partition.models.push_back(model);
+    }
+    partitions.push_back(move(partition));
+  }
+
+  return (create(move(partitions)));
+}
+
+UpAllocation Allocation::create(VecPartition partitions) {
+  return (UpAllocation(new Allocation(move(partitions))));
+}
+
+Allocation::Allocation(VecPartition partitions)
+    : __partitions_(move(partitions)) {}
+
+const Allocation::VecPartition &Allocation::getPartitions() const {
+  return (__partitions_);
+}
+
+const Allocation::Partition *
+Allocation::findPartition(const Name &lp_name) const {
+  for (const auto &partition : __partitions_) {
+    if (partition.lp_name == lp_name) {
+      return (&partition);
+    }
+  }
+  return (nullptr);
+}
+
+void Allocation::write(const Name &path) const {
+  std::ofstream file(path);
+  if (!file) {
+    throw std::runtime_error("Cannot write allocation " + path);
+  }
+
+  file << "# Seaplanes allocation: lp <name> <cpu> <models>\n";
+  for (const auto &partition : __partitions_) {
+    file << lp_keyword << ' ' << partition.lp_name << ' '
+         << (partition.cpu < 0 ? string(no_cpu) : to_string(partition.cpu));
+    for (const auto &model : partition.models) {
+      file << ' ' << model;
+    }
+    file << '\n';
+  }
+
+  if (!file) {
+    throw std::runtime_error("Cannot write allocation " + path);
+  }
+}
+
+} // namespace Seaplanes
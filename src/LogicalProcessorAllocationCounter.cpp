@@ -0,0 +1,71 @@
+//! \file    LogicalProcessorAllocationCounter.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor heap allocations counter implementation.
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <LogicalProcessorAllocationCounter.h>
+
+namespace Seaplanes {
+
+namespace {
+
+std::atomic<unsigned long long> allocations{0}; //!< Allocations counted.
+thread_local unsigned int exclusions = 0;       //!< Exclusions depth.
+
+} // namespace
+
+unsigned long long AllocationCounter::get() { return (allocations.load()); }
+
+void AllocationCounter::count() {
+  if (exclusions == 0) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+AllocationCounter::Exclusion::Exclusion() { ++exclusions; }
+
+AllocationCounter::Exclusion::~Exclusion() { --exclusions; }
+
+AllocationCounter::Inclusion::Inclusion() : __exclusions_(exclusions) {
+  exclusions = 0;
+}
+
+AllocationCounter::Inclusion::~Inclusion() { exclusions = __exclusions_; }
+
+} // namespace Seaplanes
+
+#if SEAPLANES_ALLOCATION_COUNTER
+// Replaced global allocation operators, counting the allocations.
+
+void *operator new(std::size_t size) {
+  Seaplanes::AllocationCounter::count();
+  if (auto *const p = std::malloc(size != 0 ? size : 1)) {
+    return (p);
+  }
+  throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) { return (operator new(size)); }
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+  Seaplanes::AllocationCounter::count();
+  return (std::malloc(size != 0 ? size : 1));
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &tag) noexcept {
+  return (operator new(size, tag));
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+
+void operator delete[](void *p) noexcept { std::free(p); }
+
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+#endif // SEAPLANES_ALLOCATION_COUNTER
@@ -0,0 +1,314 @@
+//! \file    LogicalProcessorAllocator.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Allocator of the models to the logical processors and cores
+//! implementation.
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <LogicalProcessorAllocator.h>
+
+using std::size_t;
+using std::vector;
+
+namespace Seaplanes {
+
+namespace {
+
+//! Largest number of branch and bound nodes explored.
+constexpr unsigned long long max_nodes = 20000000ULL;
+
+//! Largest number of local search passes.
+constexpr unsigned int max_passes = 1000;
+
+//! Cost difference below which allocations are equivalent.
+constexpr double epsilon = 1e-12;
+
+//! \brief Compare periods.
+//! \param lhs A period.
+//! \param rhs Another period.
+//! \return True if the periods are the same, up to rounding.
+bool samePeriod(double lhs, double rhs) {
+  return (std::fabs(lhs - rhs) <= 1e-9 * std::max(lhs, rhs));
+}
+
+//! \brief Models indexes, by decreasing utilization.
+//! \param problem The allocation problem.
+//! \return The models indexes.
+vector<size_t> heaviestFirst(const Allocator::Problem &problem) {
+  vector<size_t> order(problem.models.size());
+  for (auto i = 0UL; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+    return (problem.models[lhs].time / problem.models[lhs].period >
+            problem.models[rhs].time / problem.models[rhs].period);
+  });
+  return (order);
+}
+
+//! \brief Exact allocation, by branch and bound, the cost of a partial
+//! allocation only growing as models are allocated.
+class BranchAndBound final {
+public:
+  //! \brief Branch and bound constructor.
+  //! \param problem The allocation problem.
+  //! \param best The best known allocation, as a bound.
+  BranchAndBound(const Allocator::Problem &problem, const Allocator &best)
+      : __problem_(problem), __order_(heaviestFirst(problem)),
+        __allocator_(problem), __best_lps_(best.getLps()),
+        __best_cost_(best.getCost()), __nodes_(0) {}
+
+  //! \brief Search the allocation of least cost.
+  //! \return True if proven optimal, false if the search was cut short.
+  bool search() {
+    explore(0, 0);
+    return (__nodes_ < max_nodes);
+  }
+
+  //! \brief Best allocation getter.
+  //! \return The logical processor index of each model.
+  const vector<int> &getBestLps() const { return (__best_lps_); }
+
+private:
+  const Allocator::Problem &__problem_; //!< Allocation problem.
+  vector<size_t> __order_;              //!< Models, in allocation order.
+  Allocator __allocator_;               //!< Partial allocation.
+  vector<int> __best_lps_;              //!< Best allocation found.
+  double __best_cost_;                  //!< Cost of the best allocation.
+  unsigned long long __nodes_;          //!< Number of nodes explored.
+
+  //! \brief Explore the allocations of the following models.
+  //! \param depth The number of models allocated.
+  //! \param used The number of logical processors used.
+  void explore(size_t depth, int used) {
+    if (++__nodes_ >= max_nodes ||
+        __allocator_.getCost() >= __best_cost_ - epsilon) {
+      return;
+    }
+    if (depth == __order_.size()) {
+      __best_lps_ = __allocator_.getLps();
+      __best_cost_ = __allocator_.getCost();
+      return;
+    }
+
+    // Logical processors being interchangeable, a single empty one is tried.
+    const auto model = __order_[depth];
+    const auto lps_number =
+        std::min(used + 1, static_cast<int>(__problem_.cores));
+    for (auto lp = 0; lp < lps_number; ++lp) {
+      if (!__allocator_.accepts(model, lp)) {
+        continue;
+      }
+      __allocator_.allocate(model, lp);
+      explore(depth + 1, std::max(used, lp + 1));
+      __allocator_.release(model);
+    }
+  }
+};
+
+} // namespace
+
+constexpr int Allocator::unallocated;
+
+Allocator::Allocator(const Problem &problem)
+    : __problem_(problem),
+      __lps_(vector<int>(problem.models.size(), unallocated)),
+      __loads_(vector<double>(problem.cores, 0.)),
+      __periods_(vector<double>(problem.cores, 0.)),
+      __sizes_(vector<size_t>(problem.cores, 0)), __cut_(0) {}
+
+int Allocator::getLp(size_t model) const { return (__lps_[model]); }
+
+const vector<int> &Allocator::getLps() const { return (__lps_); }
+
+double Allocator::getLoad(size_t lp) const { return (__loads_[lp]); }
+
+double Allocator::getPeriod(size_t lp) const { return (__periods_[lp]); }
+
+size_t Allocator::getSize(size_t lp) const { return (__sizes_[lp]); }
+
+unsigned long long Allocator::getCut() const { return (__cut_); }
+
+double Allocator::getMakespan() const {
+  auto makespan = 0.;
+  for (auto lp = 0U; lp < __problem_.cores; ++lp) {
+    if (__sizes_[lp] > 0) {
+      makespan = std::max(makespan, __loads_[lp] / __periods_[lp]);
+    }
+  }
+  return (makespan);
+}
+
+double Allocator::getCost() const {
+  return (getMakespan() +
+          __problem_.latency_weight * static_cast<double>(__cut_));
+}
+
+bool Allocator::accepts(size_t model, size_t lp) const {
+  return (__sizes_[lp] == 0 ||
+          samePeriod(__periods_[lp], __problem_.models[model].period));
+}
+
+void Allocator::allocate(size_t model, int lp) {
+  __lps_[model] = lp;
+  __loads_[lp] += __problem_.models[model].time;
+  __periods_[lp] = __problem_.models[model].period;
+  ++__sizes_[lp];
+  exchange(model, 1.);
+}
+
+void Allocator::release(size_t model) {
+  exchange(model, -1.);
+  const auto lp = __lps_[model];
+  __loads_[lp] -= __problem_.models[model].time;
+  if (--__sizes_[lp] == 0) {
+    __loads_[lp] = 0.;
+    __periods_[lp] = 0.;
+  }
+  __lps_[model] = unallocated;
+}
+
+void Allocator::allocateGreedy() {
+  // Periods of the models, and if a logical processor has them yet.
+  vector<double> periods;
+  vector<size_t> model_periods;
+  for (const auto &model : __problem_.models) {
+    auto period = 0UL;
+    while (period < periods.size() &&
+           !samePeriod(periods[period], model.period)) {
+      ++period;
+    }
+    if (period == periods.size()) {
+      periods.push_back(model.period);
+    }
+    model_periods.push_back(period);
+  }
+  if (periods.size() > __problem_.cores) {
+    throw std::runtime_error("Not enough cores for the models periods");
+  }
+  vector<bool> served(periods.size(), false);
+  auto unserved = periods.size();
+
+  auto used = 0U;
+  for (const auto model : heaviestFirst(__problem_)) {
+    const auto period = model_periods[model];
+    // A new logical processor, if the other periods still have some.
+    const auto others_unserved = unserved - (served[period] ? 0 : 1);
+    const auto lps_number =
+        used + (__problem_.cores - used > others_unserved ? 1 : 0);
+
+    auto best_lp = unallocated;
+    auto best_cost = 0.;
+    for (auto lp = 0; lp < static_cast<int>(lps_number); ++lp) {
+      if (!accepts(model, lp)) {
+        continue;
+      }
+      allocate(model, lp);
+      const auto cost = getCost();
+      release(model);
+      if (best_lp == unallocated || cost < best_cost - epsilon) {
+        best_lp = lp;
+        best_cost = cost;
+      }
+    }
+    allocate(model, best_lp);
+    if (best_lp == static_cast<int>(used)) {
+      ++used;
+    }
+    if (!served[period]) {
+      served[period] = true;
+      --unserved;
+    }
+  }
+}
+
+void Allocator::improveLocally() {
+  const auto models_number = __problem_.models.size();
+  const auto lps_number = static_cast<int>(__problem_.cores);
+  auto improved = true;
+  for (auto pass = 0U; improved && pass < max_passes; ++pass) {
+    improved = false;
+    auto cost = getCost();
+
+    for (auto model = 0UL; model < models_number; ++model) {
+      const auto from = __lps_[model];
+      release(model);
+      auto best_lp = from;
+      for (auto lp = 0; lp < lps_number; ++lp) {
+        if (lp == from || !accepts(model, lp)) {
+          continue;
+        }
+        allocate(model, lp);
+        if (getCost() < cost - epsilon) {
+          best_lp = lp;
+          cost = getCost();
+        }
+        release(model);
+      }
+      allocate(model, best_lp);
+      improved = improved || best_lp != from;
+    }
+
+    for (auto lhs = 0UL; lhs < models_number; ++lhs) {
+      for (auto rhs = lhs + 1; rhs < models_number; ++rhs) {
+        const auto lhs_lp = __lps_[lhs];
+        const auto rhs_lp = __lps_[rhs];
+        if (lhs_lp == rhs_lp) {
+          continue;
+        }
+        release(lhs);
+        release(rhs);
+        if (accepts(lhs, rhs_lp) && accepts(rhs, lhs_lp)) {
+          allocate(lhs, rhs_lp);
+          allocate(rhs, lhs_lp);
+          if (getCost() < cost - epsilon) {
+            cost = getCost();
+            improved = true;
+            continue;
+          }
+          release(lhs);
+          release(rhs);
+        }
+        allocate(lhs, lhs_lp);
+        allocate(rhs, rhs_lp);
+      }
+    }
+  }
+}
+
+bool Allocator::allocateExactly() {
+  BranchAndBound branch_and_bound(__problem_, *this);
+  const auto exact = branch_and_bound.search();
+  const auto lps = branch_and_bound.getBestLps();
+  for (auto model = 0UL; model < lps.size(); ++model) {
+    release(model);
+  }
+  for (auto model = 0UL; model < lps.size(); ++model) {
+    allocate(model, lps[model]);
+  }
+  return (exact);
+}
+
+void Allocator::exchange(size_t model, double sign) {
+  const auto lp = __lps_[model];
+  for (const auto &dependency : __problem_.dependencies[model]) {
+    const auto other_lp = __lps_[dependency.model];
+    if (other_lp == unallocated || other_lp == lp) {
+      continue;
+    }
+    const auto cost = sign * __problem_.exchange_cost * dependency.weight;
+    __loads_[lp] += cost;
+    __loads_[other_lp] += cost;
+    if (sign > 0.) {
+      __cut_ += dependency.weight;
+    } else {
+      __cut_ -= dependency.weight;
+    }
+  }
+}
+
+} // namespace Seaplanes
@@ -4,12 +4,17 @@
 //! \date    July, 2016
 //! \brief   Rosace Attribute manipulation implementation.
 
+#include <algorithm>
+
 #include <LogicalProcessorAttribute.h>
 
 namespace Seaplanes {
 
 Attribute::Attribute(Name name)
-    : __name_(move(name)), __handle_(0), __fresh_(false), __value_({0}) {}
+    : __name_(move(name)), __handle_(0), __fresh_(false), __value_({0}),
+      __time_(0_s), __age_(0), __version_(0),
+      __staleness_(Staleness{0, 0, 0, 0, 0}),
+      __transport_(Transport::DEFAULT) {}
 
 SpAttribute Attribute::create(Name name) {
   return SpAttribute(new Attribute(move(name)));
@@ -19,16 +24,19 @@ Name Attribute::getName() const { return (__name_); }
 
 template <> void Attribute::setValue(int value) {
   __fresh_ = true;
+  ++__version_;
   __value_.i = value;
 }
 
 template <> void Attribute::setValue(double value) {
   __fresh_ = true;
+  ++__version_;
   __value_.d = value;
 }
 
 template <> void Attribute::setValue(bool value) {
   __fresh_ = true;
+  ++__version_;
   __value_.b = value;
 }
 
@@ -68,6 +76,58 @@ template <> bool Attribute::getFreshValue() const {
   return (__value_.b);
 }
 
+template <> Attribute::Sample<int> Attribute::getSample() const noexcept {
+  const auto fresh = sampleRead();
+  return (Sample<int>{__value_.i, fresh, __time_, __age_});
+}
+
+template <> Attribute::Sample<double> Attribute::getSample() const noexcept {
+  const auto fresh = sampleRead();
+  return (Sample<double>{__value_.d, fresh, __time_, __age_});
+}
+
+template <> Attribute::Sample<bool> Attribute::getSample() const noexcept {
+  const auto fresh = sampleRead();
+  return (Sample<bool>{__value_.b, fresh, __time_, __age_});
+}
+
+void Attribute::setReceived(SeaplanesTime time) {
+  __fresh_ = true;
+  __time_ = time;
+  __age_ = 0;
+  ++__version_;
+  ++__staleness_.updates;
+}
+
+void Attribute::incrementAge() { ++__age_; }
+
+const Attribute::Staleness &Attribute::getStaleness() const {
+  return (__staleness_);
+}
+
+void Attribute::addReads(const Staleness &staleness) {
+  __staleness_.reads += staleness.reads;
+  __staleness_.stale_reads += staleness.stale_reads;
+  __staleness_.ages_sum += staleness.ages_sum;
+  __staleness_.max_age = std::max(__staleness_.max_age, staleness.max_age);
+}
+
+unsigned long long Attribute::getVersion() const { return (__version_); }
+
+bool Attribute::sampleRead() const {
+  const auto fresh = __fresh_;
+  __fresh_ = false;
+
+  ++__staleness_.reads;
+  if (!fresh) {
+    ++__staleness_.stale_reads;
+  }
+  __staleness_.ages_sum += __age_;
+  __staleness_.max_age = std::max(__staleness_.max_age, __age_);
+
+  return (fresh);
+}
+
 void Attribute::setHandle(RTI::AttributeHandle attributeHandle) {
   __handle_ = attributeHandle;
 }
@@ -79,4 +139,19 @@ void Attribute::setHandle(RTI::RTIambassador *rtiAmb,
 
 RTI::AttributeHandle Attribute::getHandle() const { return (__handle_); }
 
+Attribute::State Attribute::getState() const {
+  return (State{__value_, __fresh_, __time_, __age_});
+}
+
+void Attribute::setState(const State &state) {
+  __value_ = state.value;
+  __fresh_ = state.fresh;
+  __time_ = state.time;
+  __age_ = state.age;
+}
+
+void Attribute::setTransport(Transport transport) { __transport_ = transport; }
+
+Transport Attribute::getTransport() const { return (__transport_); }
+
 } // namespace Seaplanes
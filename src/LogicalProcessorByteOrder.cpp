@@ -0,0 +1,160 @@
+//! \file    LogicalProcessorByteOrder.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor attribute values byte order implementation.
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include <LogicalProcessorByteOrder.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SEAPLANES_X86_KERNELS 1
+#include <immintrin.h>
+#else
+#define SEAPLANES_X86_KERNELS 0
+#endif
+
+namespace Seaplanes {
+
+namespace {
+
+//! \brief Type for a kernel, converting 64 bits words.
+using Kernel = void (*)(const unsigned char *, unsigned char *, std::size_t);
+
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+void copyKernel(const unsigned char *p_src, unsigned char *p_dst,
+                std::size_t count) {
+  std::memcpy(p_dst, p_src, count * ByteOrder::value_size);
+}
+#endif // __BYTE_ORDER__
+
+void scalarKernel(const unsigned char *p_src, unsigned char *p_dst,
+                  std::size_t count) {
+  for (auto i = 0UL; i < count; ++i) {
+    std::uint64_t word;
+    std::memcpy(&word, p_src + i * sizeof(word), sizeof(word));
+    word = __builtin_bswap64(word);
+    std::memcpy(p_dst + i * sizeof(word), &word, sizeof(word));
+  }
+}
+
+#if SEAPLANES_X86_KERNELS
+__attribute__((target("ssse3"))) void
+ssse3Kernel(const unsigned char *p_src, unsigned char *p_dst,
+            std::size_t count) {
+  const auto mask =
+      _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7);
+  auto i = 0UL;
+  for (; i + 2 <= count; i += 2) {
+    const auto words = _mm_loadu_si128(
+        reinterpret_cast<const __m128i *>(p_src + i * sizeof(double)));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(p_dst + i * sizeof(double)),
+                     _mm_shuffle_epi8(words, mask));
+  }
+  scalarKernel(p_src + i * sizeof(double), p_dst + i * sizeof(double),
+               count - i);
+}
+
+__attribute__((target("avx2"))) void
+avx2Kernel(const unsigned char *p_src, unsigned char *p_dst,
+           std::size_t count) {
+  // The shuffle works on each 128 bits lane.
+  const auto mask = _mm256_set_epi8(
+      8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+      13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7);
+  auto i = 0UL;
+  for (; i + 4 <= count; i += 4) {
+    const auto words = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i *>(p_src + i * sizeof(double)));
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i *>(p_dst + i * sizeof(double)),
+        _mm256_shuffle_epi8(words, mask));
+  }
+  scalarKernel(p_src + i * sizeof(double), p_dst + i * sizeof(double),
+               count - i);
+}
+#endif // SEAPLANES_X86_KERNELS
+
+//! \brief Kernel selected for the host.
+struct Selection {
+  Kernel kernel;    //!< The kernel.
+  const char *name; //!< The name of the kernel.
+};
+
+//! \brief List the kernels supported by the host.
+//! \return The supported kernels, the fastest first.
+std::vector<Selection> supportedKernels() {
+  std::vector<Selection> kernels;
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  kernels.push_back(Selection{copyKernel, "copy"});
+#else
+#if SEAPLANES_X86_KERNELS
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    kernels.push_back(Selection{avx2Kernel, "avx2"});
+  }
+  if (__builtin_cpu_supports("ssse3")) {
+    kernels.push_back(Selection{ssse3Kernel, "ssse3"});
+  }
+#endif // SEAPLANES_X86_KERNELS
+  kernels.push_back(Selection{scalarKernel, "scalar"});
+#endif // __BYTE_ORDER__
+  return (kernels);
+}
+
+//! \brief Kernels supported by the host, listed once.
+//! \return The supported kernels, the fastest first.
+const std::vector<Selection> &supported() {
+  static const auto kernels = supportedKernels();
+  return (kernels);
+}
+
+//! \brief Kernel selected for the host, the fastest by default.
+//! \return The selected kernel.
+Selection &selection() {
+  static auto selected = supported().front();
+  return (selected);
+}
+
+} // namespace
+
+constexpr std::size_t ByteOrder::value_size;
+
+void ByteOrder::encode(const double *p_values, unsigned char *p_bytes,
+                       std::size_t count) {
+  selection().kernel(reinterpret_cast<const unsigned char *>(p_values),
+                     p_bytes, count);
+}
+
+void ByteOrder::decode(const unsigned char *p_bytes, double *p_values,
+                       std::size_t count) {
+  selection().kernel(p_bytes, reinterpret_cast<unsigned char *>(p_values),
+                     count);
+}
+
+Name ByteOrder::getKernel() { return (selection().name); }
+
+std::vector<Name> ByteOrder::getKernels() {
+  std::vector<Name> names;
+  for (const auto &kernel : supported()) {
+    names.emplace_back(kernel.name);
+  }
+  return (names);
+}
+
+void ByteOrder::setKernel(const Name &name) {
+  for (const auto &kernel : supported()) {
+    if (name == kernel.name) {
+      selection() = kernel;
+      return;
+    }
+  }
+  throw std::invalid_argument("Byte order kernel " + name +
+                              " not supported by the host");
+}
+
+} // namespace Seaplanes
@@ -0,0 +1,207 @@
+//! \file    LogicalProcessorExecutor.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor parallel models execution implementation.
+
+#include <algorithm>
+
+#include <LogicalProcessorExecutor.h>
+
+using std::size_t;
+using std::vector;
+
+namespace Seaplanes {
+
+UpExecutor Executor::create(unsigned int threads_number, bool deterministic) {
+  if (threads_number == 0) {
+    threads_number = std::max(1U, std::thread::hardware_concurrency());
+  }
+  return (UpExecutor(new Executor(threads_number, deterministic)));
+}
+
+Executor::Executor(unsigned int threads_number, bool deterministic)
+    : __deterministic_(deterministic), __sp_models_(VecSpModel()),
+      __successors_(vector<vector<size_t>>()),
+      __predecessors_numbers_(vector<size_t>()), __roots_(vector<size_t>()),
+      __pending_(nullptr), __remaining_(0),
+      __workers_(vector<std::unique_ptr<Worker>>()), __mutex_(), __cv_(),
+      __running_(true), __generation_(0), __exception_(nullptr),
+      __threads_(vector<std::thread>()) {
+  for (auto i = 0U; i < threads_number; ++i) {
+    __workers_.emplace_back(new Worker{{}, {}, 0, 0});
+  }
+  for (auto i = 1U; i < threads_number; ++i) {
+    __threads_.emplace_back(&Executor::wait, this, i);
+  }
+}
+
+Executor::~Executor() {
+  {
+    std::lock_guard<std::mutex> lock(__mutex_);
+    __running_ = false;
+  }
+  __cv_.notify_all();
+  for (auto &thread : __threads_) {
+    thread.join();
+  }
+}
+
+void Executor::setup(const ModelScheduler &scheduler) {
+  __sp_models_ = scheduler.getModels();
+  const auto models_number = __sp_models_.size();
+
+  __successors_.assign(models_number, vector<size_t>());
+  __predecessors_numbers_.assign(models_number, 0);
+  for (auto i = 0UL; i < models_number; ++i) {
+    auto &successors = __successors_[i];
+    successors = scheduler.getSuccessors(i);
+    if (__deterministic_) {
+      for (const auto successor : scheduler.getDelayedSuccessors(i)) {
+        if (std::find(successors.begin(), successors.end(), successor) ==
+            successors.end()) {
+          successors.push_back(successor);
+        }
+      }
+    }
+    for (const auto successor : successors) {
+      ++__predecessors_numbers_[successor];
+    }
+  }
+
+  __roots_.clear();
+  for (const auto model : scheduler.getOrder()) {
+    if (__predecessors_numbers_[model] == 0) {
+      __roots_.push_back(model);
+    }
+  }
+
+  __pending_.reset(new std::atomic<size_t>[models_number]);
+  for (auto &up_worker : __workers_) {
+    up_worker->tasks.assign(models_number, 0);
+  }
+}
+
+void Executor::run() {
+  if (__sp_models_.empty()) {
+    return;
+  }
+
+  // Snapshots taken before any model runs, read while their writers run.
+  for (const auto &sp_model : __sp_models_) {
+    sp_model->delayedInputsSnapshotting();
+  }
+
+  for (auto i = 0UL; i < __sp_models_.size(); ++i) {
+    __pending_[i].store(__predecessors_numbers_[i], std::memory_order_relaxed);
+  }
+  for (auto &up_worker : __workers_) {
+    std::lock_guard<std::mutex> lock(up_worker->mutex);
+    up_worker->head = 0;
+    up_worker->tail = 0;
+  }
+  __remaining_.store(__sp_models_.size(), std::memory_order_release);
+  for (auto i = 0UL; i < __roots_.size(); ++i) {
+    push(i % __workers_.size(), __roots_[i]);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(__mutex_);
+    ++__generation_;
+  }
+  __cv_.notify_all();
+
+  work(0);
+
+  std::exception_ptr exception = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(__mutex_);
+    std::swap(exception, __exception_);
+  }
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+size_t Executor::getThreadsNumber() const { return (__workers_.size()); }
+
+void Executor::wait(size_t worker) {
+  auto generation = 0ULL;
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(__mutex_);
+      __cv_.wait(lock, [&] {
+        return (!__running_ || __generation_ != generation);
+      });
+      if (!__running_) {
+        return;
+      }
+      generation = __generation_;
+    }
+    work(worker);
+  }
+}
+
+void Executor::work(size_t worker) {
+  auto model = 0UL;
+
+  while (__remaining_.load(std::memory_order_acquire) > 0) {
+    if (pop(worker, model) || steal(worker, model)) {
+      execute(worker, model);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+bool Executor::pop(size_t worker, size_t &model) {
+  auto &up_worker = __workers_[worker];
+  std::lock_guard<std::mutex> lock(up_worker->mutex);
+  if (up_worker->head == up_worker->tail) {
+    return (false);
+  }
+  model = up_worker->tasks[--up_worker->tail];
+  return (true);
+}
+
+bool Executor::steal(size_t worker, size_t &model) {
+  for (auto i = 1UL; i < __workers_.size(); ++i) {
+    auto &up_worker = __workers_[(worker + i) % __workers_.size()];
+    std::lock_guard<std::mutex> lock(up_worker->mutex);
+    if (up_worker->head != up_worker->tail) {
+      model = up_worker->tasks[up_worker->head++];
+      return (true);
+    }
+  }
+  return (false);
+}
+
+void Executor::push(size_t worker, size_t model) {
+  auto &up_worker = __workers_[worker];
+  std::lock_guard<std::mutex> lock(up_worker->mutex);
+  up_worker->tasks[up_worker->tail++] = model;
+}
+
+void Executor::execute(size_t worker, size_t model) {
+  try {
+    // The inputs are copied once their writers are done.
+    __sp_models_[model]->inputsReading();
+    __sp_models_[model]->compute();
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(__mutex_);
+    if (!__exception_) {
+      __exception_ = std::current_exception();
+    }
+  }
+
+  // Successors are released even on exceptions, for the step to end.
+  for (const auto successor : __successors_[model]) {
+    if (__pending_[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      push(worker, successor);
+    }
+  }
+  __remaining_.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+} // namespace Seaplanes
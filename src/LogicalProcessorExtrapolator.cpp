@@ -0,0 +1,63 @@
+//! \file    LogicalProcessorExtrapolator.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor attribute values extrapolation implementation.
+
+#include <algorithm>
+
+#include <LogicalProcessorExtrapolator.h>
+
+namespace Seaplanes {
+
+constexpr std::size_t Extrapolator::samples_capacity;
+
+Extrapolator::Extrapolator(Order order)
+    : __order_(order), __times_(), __values_(), __samples_number_(0) {}
+
+Extrapolator::Order Extrapolator::getOrder() const { return (__order_); }
+
+void Extrapolator::addSample(SeaplanesTime time, double value) {
+  const auto time_s = time.get_s();
+
+  // A value at the same time replaces the newest one.
+  if (__samples_number_ == 0 || time_s != __times_[0]) {
+    for (auto i = samples_capacity - 1; i > 0; --i) {
+      __times_[i] = __times_[i - 1];
+      __values_[i] = __values_[i - 1];
+    }
+    __samples_number_ = std::min(__samples_number_ + 1, samples_capacity);
+  }
+  __times_[0] = time_s;
+  __values_[0] = value;
+}
+
+bool Extrapolator::empty() const { return (__samples_number_ == 0); }
+
+double Extrapolator::extrapolate(SeaplanesTime time) const {
+  if (__samples_number_ == 0) {
+    return (0.);
+  }
+
+  const auto order = std::min(static_cast<std::size_t>(__order_),
+                              __samples_number_ - 1);
+  const auto dt = time.get_s() - __times_[0];
+  if (order == 0) {
+    return (__values_[0]);
+  }
+
+  // Newton divided differences, from the newest values.
+  const auto slope =
+      (__values_[0] - __values_[1]) / (__times_[0] - __times_[1]);
+  if (order == 1) {
+    return (__values_[0] + slope * dt);
+  }
+
+  const auto previous_slope =
+      (__values_[1] - __values_[2]) / (__times_[1] - __times_[2]);
+  const auto curvature = (slope - previous_slope) / (__times_[0] - __times_[2]);
+  return (__values_[0] + slope * dt +
+          curvature * dt * (time.get_s() - __times_[1]));
+}
+
+} // namespace Seaplanes
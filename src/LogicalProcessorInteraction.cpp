@@ -0,0 +1,71 @@
+//! \file    LogicalProcessorInteraction.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor interaction, sent or received, implementation.
+
+#include <algorithm>
+
+#include <LogicalProcessorAllocationCounter.h>
+#include <LogicalProcessorByteOrder.h>
+#include <LogicalProcessorInteraction.h>
+
+using std::move;
+
+namespace Seaplanes {
+
+Interaction::Interaction(SpInteractionClass sp_interaction_class)
+    : __sp_interaction_class_(move(sp_interaction_class)),
+      __values_(std::vector<double>(
+          __sp_interaction_class_->getParametersNumber(), 0.)),
+      __time_(0_s) {}
+
+const SpInteractionClass &Interaction::getInteractionClass() const {
+  return (__sp_interaction_class_);
+}
+
+void Interaction::setInteractionClass(
+    SpInteractionClass sp_interaction_class) {
+  __sp_interaction_class_ = move(sp_interaction_class);
+  __values_.assign(__sp_interaction_class_->getParametersNumber(), 0.);
+}
+
+SeaplanesTime Interaction::getTime() const { return (__time_); }
+
+void Interaction::setTime(SeaplanesTime time) { __time_ = time; }
+
+void Interaction::encodeParameters(RTI::ParameterHandleValuePairSet &parameters,
+                                   std::vector<unsigned char> &encoded) const {
+  const auto count = __values_.size();
+  parameters.empty();
+
+  // Values are encoded at once, in network byte order, then copied into the
+  // set by the RTI.
+  ByteOrder::encode(__values_.data(), encoded.data(), count);
+  AllocationCounter::Exclusion exclusion;
+  for (auto i = 0UL; i < count; ++i) {
+    parameters.add(__sp_interaction_class_->getParameterHandle(i),
+                   reinterpret_cast<char *>(encoded.data() +
+                                            i * ByteOrder::value_size),
+                   ByteOrder::value_size);
+  }
+}
+
+void Interaction::decodeParameters(
+    const RTI::ParameterHandleValuePairSet &parameters) {
+  std::fill(__values_.begin(), __values_.end(), 0.);
+  for (auto i = 0U; i < parameters.size(); ++i) {
+    RTI::ULong length = 0;
+    const auto *const p_value = parameters.getValuePointer(i, length);
+    const auto index =
+        __sp_interaction_class_->findParameterIndex(parameters.getHandle(i));
+    if (length != ByteOrder::value_size ||
+        index == InteractionClass::no_parameter) {
+      continue;
+    }
+    ByteOrder::decode(reinterpret_cast<const unsigned char *>(p_value),
+                      &__values_[index], 1);
+  }
+}
+
+} // namespace Seaplanes
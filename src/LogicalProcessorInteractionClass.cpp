@@ -0,0 +1,97 @@
+//! \file    LogicalProcessorInteractionClass.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor interaction class manipulation implementation.
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <LogicalProcessorInteractionClass.h>
+
+using std::move;
+
+namespace Seaplanes {
+
+constexpr std::size_t InteractionClass::no_parameter;
+
+InteractionClass::InteractionClass(Name name)
+    : __handle_(0), __name_(move(name)),
+      __parameters_names_(std::vector<Name>()),
+      __parameters_handles_(std::vector<RTI::ParameterHandle>()) {}
+
+SpInteractionClass InteractionClass::create(Name name) {
+  return (SpInteractionClass(new InteractionClass(move(name))));
+}
+
+Name InteractionClass::getName() const { return (__name_); }
+
+std::size_t InteractionClass::addParameter(Name name) {
+  __parameters_names_.push_back(move(name));
+  __parameters_handles_.push_back(0);
+  return (__parameters_names_.size() - 1);
+}
+
+std::size_t InteractionClass::getParametersNumber() const {
+  return (__parameters_names_.size());
+}
+
+std::size_t InteractionClass::getParameterIndex(const Name &name) const {
+  const auto it =
+      std::find(__parameters_names_.begin(), __parameters_names_.end(), name);
+  if (it == __parameters_names_.end()) {
+    throw std::invalid_argument("No parameter " + name +
+                                " in interaction class " + __name_);
+  }
+  return (static_cast<std::size_t>(it - __parameters_names_.begin()));
+}
+
+std::size_t
+InteractionClass::findParameterIndex(RTI::ParameterHandle handle) const {
+  // Interaction classes have a few parameters.
+  const auto it = std::find(__parameters_handles_.begin(),
+                            __parameters_handles_.end(), handle);
+  return (it == __parameters_handles_.end()
+              ? no_parameter
+              : static_cast<std::size_t>(it - __parameters_handles_.begin()));
+}
+
+RTI::ParameterHandle
+InteractionClass::getParameterHandle(std::size_t index) const {
+  return (__parameters_handles_[index]);
+}
+
+void InteractionClass::setParameterHandle(std::size_t index,
+                                          RTI::ParameterHandle handle) {
+  __parameters_handles_[index] = handle;
+}
+
+void InteractionClass::setHandles(RTI::RTIambassador *p_rtia) {
+  __handle_ = p_rtia->getInteractionClassHandle(__name_.c_str());
+  for (auto i = 0UL; i < __parameters_names_.size(); ++i) {
+    __parameters_handles_[i] =
+        p_rtia->getParameterHandle(__parameters_names_[i].c_str(), __handle_);
+  }
+}
+
+RTI::InteractionClassHandle InteractionClass::getHandle() const {
+  return (__handle_);
+}
+
+void InteractionClass::publish(RTI::RTIambassador *p_rtia) {
+  p_rtia->publishInteractionClass(__handle_);
+}
+
+void InteractionClass::unpublish(RTI::RTIambassador *p_rtia) {
+  p_rtia->unpublishInteractionClass(__handle_);
+}
+
+void InteractionClass::subscribe(RTI::RTIambassador *p_rtia) {
+  p_rtia->subscribeInteractionClass(__handle_);
+}
+
+void InteractionClass::unsubscribe(RTI::RTIambassador *p_rtia) {
+  p_rtia->unsubscribeInteractionClass(__handle_);
+}
+
+} // namespace Seaplanes
@@ -0,0 +1,84 @@
+//! \file    LogicalProcessorIoThread.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor RTI input/output thread implementation.
+
+#include <LogicalProcessorAllocationCounter.h>
+#include <LogicalProcessorIoThread.h>
+
+namespace Seaplanes {
+
+namespace {
+
+//! Number of checks of the simulation thread before sleeping.
+constexpr auto spins_number = 1000U;
+
+} // namespace
+
+IoThread::Lock::Lock(IoThread *p_io_thread) : __p_io_thread_(p_io_thread) {
+  if (!__p_io_thread_) {
+    return;
+  }
+  __p_io_thread_->__rti_wanted_.store(true, std::memory_order_release);
+  __p_io_thread_->__rti_mutex_.lock();
+}
+
+IoThread::Lock::~Lock() {
+  if (!__p_io_thread_) {
+    return;
+  }
+  __p_io_thread_->__rti_mutex_.unlock();
+  __p_io_thread_->__rti_wanted_.store(false, std::memory_order_release);
+}
+
+UpIoThread IoThread::create(RTI::RTIambassador &rti_amb, double tick_time) {
+  return (UpIoThread(new IoThread(rti_amb, tick_time)));
+}
+
+IoThread::IoThread(RTI::RTIambassador &rti_amb, double tick_time)
+    : __rti_amb_(rti_amb), __tick_time_(tick_time), __rti_mutex_(),
+      __rti_wanted_(false), __running_(true), __granted_(false),
+      __notification_mutex_(), __notification_(),
+      __thread_(&IoThread::tick, this) {}
+
+IoThread::~IoThread() {
+  __running_.store(false, std::memory_order_release);
+  __thread_.join();
+}
+
+void IoThread::notifyGrant() {
+  __granted_.store(true, std::memory_order_release);
+  { std::lock_guard<std::mutex> lock(__notification_mutex_); }
+  __notification_.notify_one();
+}
+
+void IoThread::waitGrant() {
+  for (auto spins = 0U; !__granted_.load(std::memory_order_acquire) &&
+                        spins < spins_number;
+       ++spins) {
+    std::this_thread::yield();
+  }
+  {
+    std::unique_lock<std::mutex> lock(__notification_mutex_);
+    __notification_.wait(lock, [this] {
+      return (__granted_.load(std::memory_order_acquire));
+    });
+  }
+  __granted_.store(false, std::memory_order_relaxed);
+}
+
+void IoThread::tick() {
+  AllocationCounter::Exclusion exclusion;
+
+  while (__running_.load(std::memory_order_acquire)) {
+    if (__rti_wanted_.load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+      continue;
+    }
+    std::lock_guard<std::mutex> lock(__rti_mutex_);
+    __rti_amb_.tick(__tick_time_, __tick_time_);
+  }
+}
+
+} // namespace Seaplanes
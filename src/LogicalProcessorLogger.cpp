@@ -7,6 +7,7 @@
 #include <LogicalProcessorLogger.h>
 
 #include <fstream>
+#include <mutex>
 #include <ostream>
 #include <sstream>
 
@@ -20,6 +21,13 @@ using std::stringstream;
 
 namespace Seaplanes {
 
+namespace {
+
+//! Serializes the logs of the simulation and helper threads.
+std::mutex log_mutex;
+
+} // namespace
+
 Logger &Logger::get_instance(ostream *p_log_stream) {
   static auto &&instance = Logger(p_log_stream);
   return (instance);
@@ -30,6 +38,7 @@ void Logger::set_default_level(Level level) { __default_level_ = level; }
 void Logger::log(Level level, const Message &message) {
   if (__p_log_stream_ != nullptr) {
     if (level >= __default_level_) {
+      std::lock_guard<std::mutex> lock(log_mutex);
       *__p_log_stream_ << __HEADERS_.at(level) << ": " << message << endl;
     }
   }
@@ -39,6 +48,18 @@ void Logger::operator<<(const Message &message) {
   log(__default_level_, message);
 }
 
+void Logger::operator<<(const char *message) {
+  if (isLogging()) {
+    log(__default_level_, message);
+  }
+}
+
+bool Logger::isLogging(Level level) const {
+  return (__p_log_stream_ != nullptr && level >= __default_level_);
+}
+
+bool Logger::isLogging() const { return (isLogging(__default_level_)); }
+
 Logger::Level Logger::__default_level_ = Logger::Level::INFO;
 
 Logger::Logger(ostream *p_log_stream) : __p_log_stream_(p_log_stream) {}
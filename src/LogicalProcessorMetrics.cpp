@@ -0,0 +1,168 @@
+//! \file    LogicalProcessorMetrics.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor live metrics, in shared memory, implementation.
+
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <system_error>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <LogicalProcessorMetrics.h>
+
+using std::memory_order_acquire;
+using std::memory_order_relaxed;
+using std::memory_order_release;
+
+namespace Seaplanes {
+
+constexpr std::uint32_t Metrics::version;
+constexpr const char *Metrics::prefix;
+constexpr std::size_t Metrics::phases_number;
+
+namespace {
+
+//! Segments magic number, "SEAP".
+constexpr std::uint32_t magic = 0x53454150;
+
+//! Maximum number of tries to read a segment being written.
+constexpr unsigned int max_read_tries = 100000;
+
+} // namespace
+
+struct Metrics::Segment {
+  std::uint32_t magic;                 //!< Magic number.
+  std::uint32_t version;               //!< Layout version.
+  std::atomic<std::uint64_t> sequence; //!< Sequence, odd while written.
+  Snapshot snapshot;                   //!< Last published snapshot.
+};
+
+Metrics::Metrics(std::string name, Segment *p_segment)
+    : __name_(std::move(name)), __p_segment_(p_segment), __snapshot_(),
+      __received_(), __start_(std::chrono::steady_clock::now()),
+      __mark_(__start_) {}
+
+Metrics::~Metrics() {
+  munmap(__p_segment_, sizeof(Segment));
+  shm_unlink(__name_.c_str());
+}
+
+UpMetrics Metrics::create(const std::string &federate_name) {
+  const auto pid = getpid();
+  auto name = prefix + federate_name + "." + std::to_string(pid);
+  for (auto it = name.begin() + 1; it != name.end(); ++it) {
+    if (*it == '/') {
+      *it = '_';
+    }
+  }
+
+  const auto fd = shm_open(name.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+  if (fd < 0) {
+    throw std::system_error(errno, std::generic_category(), name);
+  }
+  if (ftruncate(fd, sizeof(Segment)) != 0) {
+    const auto error = errno;
+    close(fd);
+    shm_unlink(name.c_str());
+    throw std::system_error(error, std::generic_category(), name);
+  }
+  auto *const p_mapped = mmap(nullptr, sizeof(Segment),
+                              PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (p_mapped == MAP_FAILED) {
+    const auto error = errno;
+    shm_unlink(name.c_str());
+    throw std::system_error(error, std::generic_category(), name);
+  }
+
+  // The mapping is zero filled, the version is written last.
+  auto *const p_segment = new (p_mapped) Segment();
+  p_segment->magic = magic;
+  std::atomic_thread_fence(memory_order_release);
+  p_segment->version = version;
+
+  UpMetrics up_metrics(new Metrics(name, p_segment));
+  auto &snapshot = up_metrics->__snapshot_;
+  std::strncpy(snapshot.federate_name, federate_name.c_str(),
+               sizeof(snapshot.federate_name) - 1);
+  snapshot.pid = pid;
+  return (up_metrics);
+}
+
+const std::string &Metrics::getName() const { return (__name_); }
+
+Metrics::Snapshot &Metrics::getSnapshot() { return (__snapshot_); }
+
+void Metrics::start() {
+  __start_ = std::chrono::steady_clock::now();
+  __mark_ = __start_;
+}
+
+void Metrics::mark(Phase phase) {
+  const auto now = std::chrono::steady_clock::now();
+  __snapshot_.phases_times[static_cast<std::size_t>(phase)] =
+      std::chrono::duration<double>(now - __mark_).count();
+  __mark_ = now;
+}
+
+void Metrics::countReceived(std::size_t values, std::size_t bytes) {
+  __received_[0].fetch_add(1, memory_order_relaxed);
+  __received_[1].fetch_add(values, memory_order_relaxed);
+  __received_[2].fetch_add(bytes, memory_order_relaxed);
+}
+
+void Metrics::countSent(std::size_t values, std::size_t bytes) {
+  ++__snapshot_.updates_sent;
+  __snapshot_.values_sent += values;
+  __snapshot_.bytes_sent += bytes;
+}
+
+void Metrics::publish() {
+  const auto elapsed =
+      std::chrono::duration<double>(__mark_ - __start_).count();
+  if (elapsed > 0.) {
+    __snapshot_.steps_per_second = __snapshot_.step_number / elapsed;
+    __snapshot_.real_time_factor = __snapshot_.local_time / elapsed;
+  }
+  __snapshot_.reflections_received = __received_[0].load(memory_order_relaxed);
+  __snapshot_.values_received = __received_[1].load(memory_order_relaxed);
+  __snapshot_.bytes_received = __received_[2].load(memory_order_relaxed);
+
+  const auto sequence = __p_segment_->sequence.load(memory_order_relaxed);
+  __p_segment_->sequence.store(sequence + 1, memory_order_relaxed);
+  std::atomic_thread_fence(memory_order_release);
+  std::memcpy(&__p_segment_->snapshot, &__snapshot_, sizeof(Snapshot));
+  __p_segment_->sequence.store(sequence + 2, memory_order_release);
+}
+
+std::size_t Metrics::getSegmentSize() { return (sizeof(Segment)); }
+
+bool Metrics::read(const void *p_segment, Snapshot &snapshot) {
+  const auto *const p = static_cast<const Segment *>(p_segment);
+  if (p->magic != magic || p->version != version) {
+    return (false);
+  }
+
+  // A writer stopped while writing is not waited for.
+  for (auto tries = 0U; tries < max_read_tries; ++tries) {
+    const auto sequence = p->sequence.load(memory_order_acquire);
+    if ((sequence & 1) != 0) {
+      std::this_thread::yield();
+      continue;
+    }
+    std::memcpy(&snapshot, &p->snapshot, sizeof(Snapshot));
+    std::atomic_thread_fence(memory_order_acquire);
+    if (p->sequence.load(memory_order_relaxed) == sequence) {
+      return (true);
+    }
+  }
+  return (false);
+}
+
+} // namespace Seaplanes
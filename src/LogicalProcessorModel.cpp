@@ -0,0 +1,92 @@
+//! \file    LogicalProcessorModel.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor model implementation.
+
+#include <LogicalProcessorModel.h>
+
+using std::move;
+
+namespace Seaplanes {
+
+Model::Model(Name name)
+    : __name_(move(name)), __inputs_(VecSpAttribute()),
+      __delayed_inputs_(VecSpAttribute()), __outputs_(VecSpAttribute()),
+      __input_ports_(VecSpAttribute()),
+      __inputs_versions_(std::vector<unsigned long long>()),
+      __delayed_snapshots_(VecSpAttribute()),
+      __delayed_versions_(std::vector<unsigned long long>()) {}
+
+Name Model::getName() const { return (__name_); }
+
+const VecSpAttribute &Model::getInputs() const { return (__inputs_); }
+
+const VecSpAttribute &Model::getDelayedInputs() const {
+  return (__delayed_inputs_);
+}
+
+void Model::delayedInputsSnapshotting() {
+  for (auto i = 0UL; i < __delayed_inputs_.size(); ++i) {
+    reading(*__delayed_inputs_[i], *__delayed_snapshots_[i],
+            __delayed_versions_[i]);
+  }
+}
+
+void Model::inputsReading() {
+  for (auto i = 0UL; i < __inputs_.size(); ++i) {
+    reading(*__inputs_[i], *__input_ports_[i], __inputs_versions_[i]);
+  }
+}
+
+void Model::readsAccounting() {
+  for (auto i = 0UL; i < __inputs_.size(); ++i) {
+    __inputs_[i]->addReads(__input_ports_[i]->getStaleness());
+  }
+  for (auto i = 0UL; i < __delayed_inputs_.size(); ++i) {
+    __delayed_inputs_[i]->addReads(__delayed_snapshots_[i]->getStaleness());
+  }
+}
+
+const VecSpAttribute &Model::getOutputs() const { return (__outputs_); }
+
+double Model::getErrorEstimate() const { return (0.); }
+
+SpAttribute Model::addInput(SpAttribute sp_attribute, bool delayed) {
+  auto version = 0ULL;
+  auto sp_port = port(*sp_attribute, version);
+  if (!delayed) {
+    __inputs_.push_back(move(sp_attribute));
+    __input_ports_.push_back(sp_port);
+    __inputs_versions_.push_back(version);
+    return (sp_port);
+  }
+
+  // The snapshot holds the value written at the previous step.
+  __delayed_inputs_.push_back(move(sp_attribute));
+  __delayed_snapshots_.push_back(sp_port);
+  __delayed_versions_.push_back(version);
+  return (sp_port);
+}
+
+void Model::addOutput(SpAttribute sp_attribute) {
+  __outputs_.push_back(move(sp_attribute));
+}
+
+void Model::reading(const Attribute &attribute, Attribute &port,
+                    unsigned long long &version) {
+  auto state = attribute.getState();
+  state.fresh = attribute.getVersion() != version || port.getState().fresh;
+  version = attribute.getVersion();
+  port.setState(state);
+}
+
+SpAttribute Model::port(const Attribute &attribute,
+                        unsigned long long &version) {
+  auto sp_port = Attribute::create(attribute.getName());
+  sp_port->setState(attribute.getState());
+  version = attribute.getVersion();
+  return (sp_port);
+}
+
+} // namespace Seaplanes
@@ -0,0 +1,176 @@
+//! \file    LogicalProcessorModelScheduler.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor models scheduling implementation.
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <stdexcept>
+
+#include <LogicalProcessorModelScheduler.h>
+
+using std::move;
+using std::size_t;
+using std::vector;
+
+namespace Seaplanes {
+
+ModelScheduler::ModelScheduler()
+    : __sp_models_(VecSpModel()), __order_(vector<size_t>()),
+      __successors_(vector<vector<size_t>>()),
+      __predecessors_numbers_(vector<size_t>()),
+      __delayed_successors_(vector<vector<size_t>>()),
+      __delayed_predecessors_numbers_(vector<size_t>()), __profiling_(false),
+      __compute_times_(vector<double>()), __runs_number_(0) {}
+
+void ModelScheduler::addModel(SpModel sp_model) {
+  __sp_models_.push_back(move(sp_model));
+}
+
+const VecSpModel &ModelScheduler::getModels() const { return (__sp_models_); }
+
+void ModelScheduler::order() {
+  const auto models_number = __sp_models_.size();
+  __compute_times_.assign(models_number, 0.);
+  __runs_number_ = 0;
+
+  // Producer of each attribute.
+  std::map<const Attribute *, size_t> producers;
+  for (auto i = 0UL; i < models_number; ++i) {
+    for (const auto &sp_output : __sp_models_[i]->getOutputs()) {
+      if (!producers.emplace(sp_output.get(), i).second) {
+        throw std::logic_error("Attribute " + sp_output->getName() +
+                               " output of several models");
+      }
+    }
+  }
+
+  __successors_.assign(models_number, vector<size_t>());
+  __predecessors_numbers_.assign(models_number, 0);
+  for (auto i = 0UL; i < models_number; ++i) {
+    for (const auto &sp_input : __sp_models_[i]->getInputs()) {
+      const auto it = producers.find(sp_input.get());
+      if (it != producers.end() && it->second != i) {
+        addEdge(it->second, i, __successors_, __predecessors_numbers_);
+      }
+    }
+  }
+
+  // Kahn's algorithm, the first ready model in declaration order first.
+  __order_.clear();
+  auto predecessors_numbers = __predecessors_numbers_;
+  vector<bool> done(models_number, false);
+  while (__order_.size() < models_number) {
+    auto ready = models_number;
+    for (auto i = 0UL; i < models_number; ++i) {
+      if (!done[i] && predecessors_numbers[i] == 0) {
+        ready = i;
+        break;
+      }
+    }
+    if (ready == models_number) {
+      Name cycle;
+      for (auto i = 0UL; i < models_number; ++i) {
+        if (!done[i]) {
+          cycle += " " + __sp_models_[i]->getName();
+        }
+      }
+      throw std::logic_error("Models loop without delayed input:" + cycle);
+    }
+
+    done[ready] = true;
+    __order_.push_back(ready);
+    for (const auto successor : __successors_[ready]) {
+      --predecessors_numbers[successor];
+    }
+  }
+
+  // Delayed inputs, reader and writer in execution order.
+  vector<size_t> ranks(models_number);
+  for (auto rank = 0UL; rank < models_number; ++rank) {
+    ranks[__order_[rank]] = rank;
+  }
+  __delayed_successors_.assign(models_number, vector<size_t>());
+  __delayed_predecessors_numbers_.assign(models_number, 0);
+  for (auto i = 0UL; i < models_number; ++i) {
+    for (const auto &sp_input : __sp_models_[i]->getDelayedInputs()) {
+      const auto it = producers.find(sp_input.get());
+      if (it == producers.end() || it->second == i) {
+        continue;
+      }
+      if (ranks[i] < ranks[it->second]) {
+        addEdge(i, it->second, __delayed_successors_,
+                __delayed_predecessors_numbers_);
+      } else {
+        addEdge(it->second, i, __delayed_successors_,
+                __delayed_predecessors_numbers_);
+      }
+    }
+  }
+}
+
+const vector<size_t> &ModelScheduler::getOrder() const { return (__order_); }
+
+const vector<size_t> &ModelScheduler::getSuccessors(size_t model) const {
+  return (__successors_[model]);
+}
+
+size_t ModelScheduler::getPredecessorsNumber(size_t model) const {
+  return (__predecessors_numbers_[model]);
+}
+
+const vector<size_t> &ModelScheduler::getDelayedSuccessors(size_t model) const {
+  return (__delayed_successors_[model]);
+}
+
+size_t ModelScheduler::getDelayedPredecessorsNumber(size_t model) const {
+  return (__delayed_predecessors_numbers_[model]);
+}
+
+void ModelScheduler::run() {
+  for (const auto &sp_model : __sp_models_) {
+    sp_model->delayedInputsSnapshotting();
+  }
+
+  if (!__profiling_) {
+    for (const auto model : __order_) {
+      __sp_models_[model]->inputsReading();
+      __sp_models_[model]->compute();
+    }
+    return;
+  }
+
+  using Clock = std::chrono::steady_clock;
+  for (const auto model : __order_) {
+    const auto start = Clock::now();
+    __sp_models_[model]->inputsReading();
+    __sp_models_[model]->compute();
+    __compute_times_[model] +=
+        std::chrono::duration<double>(Clock::now() - start).count();
+  }
+  ++__runs_number_;
+}
+
+void ModelScheduler::enableProfiling() { __profiling_ = true; }
+
+double ModelScheduler::getMeanComputeTime(size_t model) const {
+  if (__runs_number_ == 0) {
+    return (0.);
+  }
+  return (__compute_times_[model] / static_cast<double>(__runs_number_));
+}
+
+void ModelScheduler::addEdge(size_t from, size_t to,
+                             vector<vector<size_t>> &successors,
+                             vector<size_t> &predecessors_numbers) {
+  auto &from_successors = successors[from];
+  if (std::find(from_successors.begin(), from_successors.end(), to) ==
+      from_successors.end()) {
+    from_successors.push_back(to);
+    ++predecessors_numbers[to];
+  }
+}
+
+} // namespace Seaplanes
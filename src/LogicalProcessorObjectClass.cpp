@@ -8,7 +8,8 @@
 
 namespace Seaplanes {
 
-Object::Object(Name name) : __handle_(0), __name_(move(name)) {}
+Object::Object(Name name)
+    : __handle_(0), __name_(move(name)), __transport_(Transport::DEFAULT) {}
 
 SpObject Object::create(Name name) {
   return (SpObject(new Object(move(name))));
@@ -24,4 +25,8 @@ void Object::setHandle(RTI::RTIambassador *p_rtia) {
 
 RTI::ObjectClassHandle Object::getHandle() const { return (__handle_); }
 
+void Object::setTransport(Transport transport) { __transport_ = transport; }
+
+Transport Object::getTransport() const { return (__transport_); }
+
 } // namespace Seaplanes
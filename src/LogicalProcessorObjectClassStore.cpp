@@ -0,0 +1,99 @@
+//! \file    LogicalProcessorObjectClassStore.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor struct-of-arrays attributes storage
+//! implementation.
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <LogicalProcessorObjectClassStore.h>
+
+using std::move;
+
+namespace Seaplanes {
+
+namespace {
+
+//! Number of values in an aligned block.
+constexpr auto values_per_block = ObjectClassStore::alignment / sizeof(double);
+
+} // namespace
+
+constexpr std::size_t ObjectClassStore::alignment;
+
+ObjectClassStore::ObjectClassStore(std::vector<Name> attributes_names,
+                                   std::size_t capacity)
+    : __attributes_names_(move(attributes_names)), __capacity_(capacity),
+      __size_(0),
+      __stride_((capacity + values_per_block - 1) / values_per_block *
+                values_per_block),
+      __buffer_(__stride_ * __attributes_names_.size() + values_per_block, 0.),
+      __p_values_(nullptr),
+      __fresh_(__stride_ * __attributes_names_.size(), 0) {
+  void *p_buffer = __buffer_.data();
+  auto space = __buffer_.size() * sizeof(double);
+  __p_values_ = static_cast<double *>(
+      std::align(alignment, __stride_ * __attributes_names_.size() *
+                                sizeof(double),
+                 p_buffer, space));
+}
+
+SpObjectClassStore ObjectClassStore::create(std::vector<Name> attributes_names,
+                                            std::size_t capacity) {
+  return (SpObjectClassStore(
+      new ObjectClassStore(move(attributes_names), capacity)));
+}
+
+std::size_t ObjectClassStore::addInstance() {
+  if (__size_ == __capacity_) {
+    throw std::length_error("Object class store full");
+  }
+  return (__size_++);
+}
+
+std::size_t ObjectClassStore::getSize() const { return (__size_); }
+
+std::size_t ObjectClassStore::getColumn(const Name &attribute_name) const {
+  const auto it = std::find(__attributes_names_.begin(),
+                            __attributes_names_.end(), attribute_name);
+  if (it == __attributes_names_.end()) {
+    throw std::out_of_range("Attribute " + attribute_name + " not stored");
+  }
+  return (static_cast<std::size_t>(it - __attributes_names_.begin()));
+}
+
+Span<double> ObjectClassStore::getValues(std::size_t column) {
+  return (Span<double>(__p_values_ + column * __stride_, __size_));
+}
+
+Span<const double> ObjectClassStore::getValues(std::size_t column) const {
+  return (Span<const double>(__p_values_ + column * __stride_, __size_));
+}
+
+Span<unsigned char> ObjectClassStore::getFresh(std::size_t column) {
+  return (Span<unsigned char>(__fresh_.data() + column * __stride_, __size_));
+}
+
+double ObjectClassStore::getValue(std::size_t column, std::size_t slot) const {
+  return (__p_values_[column * __stride_ + slot]);
+}
+
+void ObjectClassStore::setValue(std::size_t column, std::size_t slot,
+                                double value) {
+  __p_values_[column * __stride_ + slot] = value;
+  __fresh_[column * __stride_ + slot] = 1;
+}
+
+void ObjectClassStore::getState(State &state) const {
+  state.values.assign(__p_values_, __p_values_ + __fresh_.size());
+  state.fresh.assign(__fresh_.begin(), __fresh_.end());
+}
+
+void ObjectClassStore::setState(const State &state) {
+  std::copy(state.values.begin(), state.values.end(), __p_values_);
+  std::copy(state.fresh.begin(), state.fresh.end(), __fresh_.begin());
+}
+
+} // namespace Seaplanes
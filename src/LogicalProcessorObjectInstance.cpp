@@ -4,6 +4,9 @@
 //! \date    July, 2016
 //! \brief   Rosace Object instance manipulation implementation.
 
+#include <algorithm>
+#include <stdexcept>
+
 #include <LogicalProcessorObjectInstance.h>
 
 namespace Seaplanes {
@@ -11,7 +14,9 @@ namespace Seaplanes {
 ObjectInstance::ObjectInstance(Name name, SpObject sp_object)
     : __name_(move(name)), __sp_object_(move(sp_object)), __handle_(0),
       __up_instance_object_(nullptr), __up_instance_attributes_(nullptr),
-      __sp_attributes_(VecSpAttribute()), __discovered_(false) {}
+      __sp_attributes_(VecSpAttribute()), __discovered_(false),
+      __sp_region_(nullptr), __sp_store_(nullptr), __store_slot_(0),
+      __store_columns_(std::vector<std::size_t>()) {}
 
 Name ObjectInstance::getName() const { return (__name_); }
 
@@ -26,9 +31,16 @@ RTI::ObjectClassHandle ObjectInstance::getObjectClassHandle() const {
 }
 
 void ObjectInstance::addAttribute(SpAttribute sp_attribute) {
+  if (__sp_store_) {
+    __store_columns_.push_back(__sp_store_->getColumn(sp_attribute->getName()));
+  }
   __sp_attributes_.push_back(sp_attribute);
 }
 
+const VecSpAttribute &ObjectInstance::getAttributes() const {
+  return (__sp_attributes_);
+}
+
 void ObjectInstance::setAttributesHandles(RTI::RTIambassador *p_rtia) {
   __up_instance_attributes_.reset(
       RTI::AttributeHandleSetFactory::create(__sp_attributes_.size()));
@@ -44,4 +56,50 @@ void ObjectInstance::unsetDiscovered() { __discovered_ = false; }
 
 bool ObjectInstance::getDiscovered() const { return (__discovered_); }
 
+void ObjectInstance::setRegion(SpRegion sp_region) {
+  __sp_region_ = move(sp_region);
+}
+
+const SpRegion &ObjectInstance::getRegion() const { return (__sp_region_); }
+
+void ObjectInstance::setStore(SpObjectClassStore sp_store) {
+  __store_columns_.clear();
+  for (const SpAttribute &sp_attribute : __sp_attributes_) {
+    __store_columns_.push_back(sp_store->getColumn(sp_attribute->getName()));
+  }
+  __store_slot_ = sp_store->addInstance();
+  __sp_store_ = move(sp_store);
+}
+
+const SpObjectClassStore &ObjectInstance::getStore() const {
+  return (__sp_store_);
+}
+
+std::size_t ObjectInstance::getStoreSlot() const { return (__store_slot_); }
+
+double ObjectInstance::getAttributeValue(std::size_t index) const {
+  return (__sp_store_
+              ? __sp_store_->getValue(__store_columns_[index], __store_slot_)
+              : __sp_attributes_[index]->getValue<double>());
+}
+
+void ObjectInstance::setAttributeValue(std::size_t index, double value) {
+  if (__sp_store_) {
+    __sp_store_->setValue(__store_columns_[index], __store_slot_, value);
+  } else {
+    __sp_attributes_[index]->setValue(value);
+  }
+}
+
+std::size_t
+ObjectInstance::getAttributeIndex(const SpAttribute &sp_attribute) const {
+  const auto it =
+      std::find(__sp_attributes_.begin(), __sp_attributes_.end(), sp_attribute);
+  if (it == __sp_attributes_.end()) {
+    throw std::invalid_argument("Attribute " + sp_attribute->getName() +
+                                " not in object instance " + __name_);
+  }
+  return (static_cast<std::size_t>(it - __sp_attributes_.begin()));
+}
+
 } // namespace Seaplanes
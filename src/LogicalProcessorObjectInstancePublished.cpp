@@ -4,6 +4,10 @@
 //! \date    July, 2016
 //! \brief   Rosace Published object instance manipulation implementation.
 
+#include <algorithm>
+
+#include <LogicalProcessorAllocationCounter.h>
+#include <LogicalProcessorByteOrder.h>
 #include <LogicalProcessorObjectInstancePublished.h>
 
 using std::make_unique;
@@ -11,8 +15,23 @@ using std::string;
 
 namespace Seaplanes {
 
+namespace {
+
+//! Name of the best effort transportation type.
+constexpr const char *best_effort_transport = "HLAbestEffort";
+
+} // namespace
+
 ObjectInstancePublished::ObjectInstancePublished(Name name, SpObject sp_object)
-    : ObjectInstance(move(name), move(sp_object)) {}
+    : ObjectInstance(move(name), move(sp_object)), __relevance_advised_(false),
+      __relevant_attributes_(std::vector<bool>()),
+      __relevant_attributes_number_(0), __values_(std::vector<double>()),
+      __encoded_values_(std::vector<unsigned char>()),
+      __encoded_handles_(std::vector<RTI::AttributeHandle>()),
+      __update_policies_(std::vector<UpdatePolicy>()),
+      __receive_ordered_(std::vector<bool>()),
+      __attribute_groups_(std::vector<Group>()), __group_starts_({}),
+      __group_counts_({}), __updates_selected_(false), __selected_time_(0_s) {}
 
 UpObjectInstancePublished ObjectInstancePublished::create(Name name,
                                                           SpObject sp_object) {
@@ -29,43 +48,297 @@ void ObjectInstancePublished::registering(RTI::RTIambassador *rtiAmb) {
                                              __name_.c_str());
   __up_instance_object_.reset(
       RTI::AttributeSetFactory::create(__sp_attributes_.size()));
+  __values_.resize(__sp_attributes_.size());
+  __encoded_values_.resize(__sp_attributes_.size() * ByteOrder::value_size);
+  __encoded_handles_.resize(__sp_attributes_.size());
+  __update_policies_.resize(__sp_attributes_.size());
+  __receive_ordered_.resize(__sp_attributes_.size(), false);
+  grouping();
+  if (__sp_region_) {
+    rtiAmb->associateRegionForUpdates(__sp_region_->getRegion(), __handle_,
+                                      *__up_instance_attributes_);
+  }
+
+  UpRTIAttributeHandleSet up_best_effort_attributes(
+      RTI::AttributeHandleSetFactory::create(__sp_attributes_.size()));
+  for (auto i = 0U; i < __sp_attributes_.size(); ++i) {
+    if (getTransport(i) == Transport::BEST_EFFORT) {
+      up_best_effort_attributes->add(__sp_attributes_[i]->getHandle());
+    }
+  }
+  if (up_best_effort_attributes->size() != 0) {
+    rtiAmb->changeAttributeTransportationType(
+        __handle_, *up_best_effort_attributes,
+        rtiAmb->getTransportationHandle(best_effort_transport));
+  }
 }
 
-void ObjectInstancePublished::updateAttributeValues(
-    RTI::RTIambassador *rtiAmb,
-    libhla::MessageBuffer *certiMessagebuffer __attribute__((unused)),
+RTI::EventRetractionHandle ObjectInstancePublished::updateAttributeValues(
+    RTI::RTIambassador *rtiAmb, libhla::MessageBuffer *certiMessagebuffer,
     const RTIfedTime &time, const string &tag) {
+  updatesSelecting(time);
+  __updates_selected_ = false;
   __up_instance_object_->empty();
+  encodeValues(certiMessagebuffer, TSO_RELIABLE);
+  encodeValues(certiMessagebuffer, TSO_BEST_EFFORT);
+  AllocationCounter::Exclusion exclusion;
+  return rtiAmb->updateAttributeValues(getHandle(), *__up_instance_object_,
+                                       time, tag.c_str());
+}
+
+RTI::EventRetractionHandle ObjectInstancePublished::updateAttributeValues(
+    RTI::RTIambassador *rtiAmb, libhla::MessageBuffer *certiMessagebuffer,
+    const RTIfedTime &time) {
+  return updateAttributeValues(rtiAmb, certiMessagebuffer, time, __name_);
+}
+
+RTI::EventRetractionHandle ObjectInstancePublished::updateAttributeValues(
+    RTI::RTIambassador *rtiAmb, libhla::MessageBuffer *certiMessagebuffer,
+    const RTIfedTime &time, const string &tag, Transport transport) {
+  // Selected once for the updates of both transports.
+  updatesSelecting(time);
+  __up_instance_object_->empty();
+  encodeValues(certiMessagebuffer, transport == Transport::BEST_EFFORT
+                                       ? TSO_BEST_EFFORT
+                                       : TSO_RELIABLE);
+  AllocationCounter::Exclusion exclusion;
+  return rtiAmb->updateAttributeValues(getHandle(), *__up_instance_object_,
+                                       time, tag.c_str());
+}
+
+void ObjectInstancePublished::updateReceiveOrderValues(
+    RTI::RTIambassador *rtiAmb, libhla::MessageBuffer *certiMessagebuffer,
+    const RTIfedTime &time, const string &tag) {
+  updatesSelecting(time);
+  for (const auto group : {RO_RELIABLE, RO_BEST_EFFORT}) {
+    if (__group_counts_[group] == 0) {
+      continue;
+    }
+    __up_instance_object_->empty();
+    encodeValues(certiMessagebuffer, group);
+    AllocationCounter::Exclusion exclusion;
+    rtiAmb->updateAttributeValues(getHandle(), *__up_instance_object_,
+                                  tag.c_str());
+  }
+}
+
+void ObjectInstancePublished::encodeValues(
+    libhla::MessageBuffer *certiMessagebuffer __attribute__((unused)),
+    Group group) {
+  const auto first = __group_starts_[group];
+  const auto count = __group_counts_[group];
+  const auto last = first + count;
 
-  for (auto &sp_attribute : __sp_attributes_) {
-    auto value = sp_attribute->getValue<double>();
 #if USE_CERTI_MESSAGE_BUFFER
+  AllocationCounter::Exclusion exclusion;
+  for (auto i = first; i < last; ++i) {
     certiMessagebuffer->reset();
-    certiMessagebuffer->write_double(value);
+    certiMessagebuffer->write_double(__values_[i]);
     certiMessagebuffer->updateReservedBytes();
-    instance_object_->add(attribute->getHandle(),
-                          static_cast<char *>((*certiMessagebuffer)(0)),
-                          certiMessagebuffer->size());
+    __up_instance_object_->add(__encoded_handles_[i],
+                               static_cast<char *>((*certiMessagebuffer)(0)),
+                               certiMessagebuffer->size());
+  }
 #else  // USE_CERTI_MESSAGE_BUFFER
-    // dependant. (For instance 64bits LE).
-    auto *const messageBuffer = reinterpret_cast<char *>(&value);
-    __up_instance_object_->add(sp_attribute->getHandle(), messageBuffer,
-                               sizeof(double));
+  // Values are encoded at once, in network byte order.
+  ByteOrder::encode(__values_.data() + first,
+                    __encoded_values_.data() + first * ByteOrder::value_size,
+                    count);
+  // The values are copied into the set by the RTI.
+  AllocationCounter::Exclusion exclusion;
+  for (auto i = first; i < last; ++i) {
+    __up_instance_object_->add(
+        __encoded_handles_[i],
+        reinterpret_cast<char *>(__encoded_values_.data() +
+                                 i * ByteOrder::value_size),
+        ByteOrder::value_size);
+  }
 #endif // USE_CERTI_MESSAGE_BUFFER
+}
+
+void ObjectInstancePublished::unpublish(RTI::RTIambassador *rtiAmb) {
+  if (__sp_region_) {
+    rtiAmb->unassociateRegionForUpdates(__sp_region_->getRegion(), __handle_);
   }
+  rtiAmb->unpublishObjectClass(__sp_object_->getHandle());
+}
 
-  rtiAmb->updateAttributeValues(getHandle(), *__up_instance_object_, time,
-                                tag.c_str());
+void ObjectInstancePublished::setRelevanceAdvised() {
+  __relevance_advised_ = true;
+  __relevant_attributes_.assign(__sp_attributes_.size(), false);
+  __relevant_attributes_number_ = 0;
 }
 
-void ObjectInstancePublished::updateAttributeValues(
-    RTI::RTIambassador *rtiAmb, libhla::MessageBuffer *certiMessagebuffer,
-    const RTIfedTime &time) {
-  updateAttributeValues(rtiAmb, certiMessagebuffer, time, __name_);
+void ObjectInstancePublished::stopRegistration() {
+  if (__relevance_advised_) {
+    __relevant_attributes_.assign(__sp_attributes_.size(), false);
+    __relevant_attributes_number_ = 0;
+  }
+  for (auto &policy : __update_policies_) {
+    policy.reset();
+  }
 }
 
-void ObjectInstancePublished::unpublish(RTI::RTIambassador *rtiAmb) {
-  rtiAmb->unpublishObjectClass(__sp_object_->getHandle());
+void ObjectInstancePublished::turnUpdatesOn(
+    const RTI::AttributeHandleSet &handles) {
+  setRelevance(handles, true);
+}
+
+void ObjectInstancePublished::turnUpdatesOff(
+    const RTI::AttributeHandleSet &handles) {
+  setRelevance(handles, false);
+}
+
+bool ObjectInstancePublished::getUpdatesRelevant() const {
+  return (!__relevance_advised_ || __relevant_attributes_number_ != 0);
+}
+
+void ObjectInstancePublished::setUpdatePolicy(const SpAttribute &sp_attribute,
+                                              UpdatePolicy policy) {
+  const auto index = getAttributeIndex(sp_attribute);
+  if (__update_policies_.size() < __sp_attributes_.size()) {
+    __update_policies_.resize(__sp_attributes_.size());
+  }
+  __update_policies_[index] = policy;
+}
+
+const std::vector<UpdatePolicy> &
+ObjectInstancePublished::getUpdatePolicies() const {
+  return (__update_policies_);
+}
+
+void ObjectInstancePublished::setUpdatePolicies(
+    const std::vector<UpdatePolicy> &policies) {
+  // Policies saved before registering may miss the default ones.
+  __update_policies_ = policies;
+  __update_policies_.resize(__sp_attributes_.size());
+}
+
+void ObjectInstancePublished::setDeadReckoning(const SpAttribute &sp_attribute,
+                                               Extrapolator::Order order,
+                                               double threshold) {
+  setUpdatePolicy(sp_attribute, threshold < 0.
+                                    ? UpdatePolicy::always()
+                                    : UpdatePolicy::deadReckoning(order,
+                                                                  threshold));
+}
+
+void ObjectInstancePublished::setReceiveOrder(const SpAttribute &sp_attribute) {
+  const auto index = getAttributeIndex(sp_attribute);
+  if (__receive_ordered_.size() < __sp_attributes_.size()) {
+    __receive_ordered_.resize(__sp_attributes_.size(), false);
+  }
+  __receive_ordered_[index] = true;
+  grouping();
+}
+
+void ObjectInstancePublished::setReceiveOrder() {
+  __receive_ordered_.assign(__sp_attributes_.size(), true);
+  grouping();
+}
+
+bool ObjectInstancePublished::hasReceiveOrder() const {
+  return (std::find(__receive_ordered_.begin(), __receive_ordered_.end(),
+                    true) != __receive_ordered_.end());
+}
+
+bool ObjectInstancePublished::selectUpdates(const RTIfedTime &time) {
+  __group_counts_.fill(0);
+
+  __selected_time_ =
+      SeaplanesTime(static_cast<unsigned long long>(time.getTime()));
+  if (getUpdatesRelevant()) {
+    for (auto i = 0U; i < __sp_attributes_.size(); ++i) {
+      if (__relevance_advised_ && !__relevant_attributes_[i]) {
+        continue;
+      }
+      const auto value = getAttributeValue(i);
+      if (!__update_policies_[i].select(value, __selected_time_)) {
+        continue;
+      }
+      const auto group = __attribute_groups_[i];
+      const auto slot = __group_starts_[group] + __group_counts_[group]++;
+      __values_[slot] = value;
+      __encoded_handles_[slot] = __sp_attributes_[i]->getHandle();
+    }
+  }
+
+  __updates_selected_ = true;
+  return (getUpdateSize() != 0 || getReceiveOrderUpdateSize() != 0);
+}
+
+void ObjectInstancePublished::updatesSelecting(const RTIfedTime &time) {
+  if (!__updates_selected_ ||
+      __selected_time_ !=
+          SeaplanesTime(static_cast<unsigned long long>(time.getTime()))) {
+    selectUpdates(time);
+  }
+}
+
+std::size_t ObjectInstancePublished::getUpdateSize() const {
+  return (__group_counts_[TSO_RELIABLE] + __group_counts_[TSO_BEST_EFFORT]);
+}
+
+std::size_t ObjectInstancePublished::getUpdateSize(Transport transport) const {
+  return (__group_counts_[transport == Transport::BEST_EFFORT
+                              ? TSO_BEST_EFFORT
+                              : TSO_RELIABLE]);
+}
+
+std::size_t ObjectInstancePublished::getReceiveOrderUpdateSize() const {
+  return (__group_counts_[RO_RELIABLE] + __group_counts_[RO_BEST_EFFORT]);
+}
+
+void ObjectInstancePublished::grouping() {
+  __attribute_groups_.resize(__sp_attributes_.size());
+  std::array<std::size_t, GROUPS_NUMBER> sizes{};
+  for (auto i = 0U; i < __sp_attributes_.size(); ++i) {
+    const auto receive_ordered =
+        i < __receive_ordered_.size() && __receive_ordered_[i];
+    const auto best_effort = getTransport(i) == Transport::BEST_EFFORT;
+    const auto group = receive_ordered
+                           ? (best_effort ? RO_BEST_EFFORT : RO_RELIABLE)
+                           : (best_effort ? TSO_BEST_EFFORT : TSO_RELIABLE);
+    __attribute_groups_[i] = group;
+    ++sizes[group];
+  }
+
+  auto start = 0UL;
+  for (auto group = 0U; group < GROUPS_NUMBER; ++group) {
+    __group_starts_[group] = start;
+    start += sizes[group];
+  }
+  __group_counts_.fill(0);
+}
+
+Transport ObjectInstancePublished::getTransport(std::size_t index) const {
+  const auto transport = __sp_attributes_[index]->getTransport();
+  return (transport != Transport::DEFAULT ? transport
+                                          : __sp_object_->getTransport());
+}
+
+void ObjectInstancePublished::setRelevance(
+    const RTI::AttributeHandleSet &handles, bool relevant) {
+  if (!__relevance_advised_) {
+    return;
+  }
+  for (auto i = 0U; i < __sp_attributes_.size(); ++i) {
+    if (!handles.isMember(__sp_attributes_[i]->getHandle())) {
+      continue;
+    }
+    // Turned on again, or for new subscribers: sent at the next update.
+    if (relevant) {
+      __update_policies_[i].reset();
+    }
+    if (__relevant_attributes_[i] != relevant) {
+      __relevant_attributes_[i] = relevant;
+      if (relevant) {
+        ++__relevant_attributes_number_;
+      } else {
+        --__relevant_attributes_number_;
+      }
+    }
+  }
 }
 
 } // namespace Seaplanes
@@ -4,22 +4,27 @@
 //! \date    July, 2016
 //! \brief   Rosace Subscribed object instance manipulation implementation.
 
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+#include <LogicalProcessorByteOrder.h>
 #include <LogicalProcessorObjectInstanceSubscribed.h>
 
 using std::make_unique;
 
 namespace Seaplanes {
 
-#if !USE_CERTI_MESSAGE_BUFFER
-// If the CERTI message buffer is not used, a buffer is declared for reception.
-#define MESSAGE_BUFFER_LENGTH 256
-char messageBuffer[MESSAGE_BUFFER_LENGTH];
-#endif // USE_CERTI_MESSAGE_BUFFER
-
 ObjectInstanceSubscribed::ObjectInstanceSubscribed(Name name,
                                                    SpObject sp_object)
     : ObjectInstance(move(name), move(sp_object)),
-      __map_sp_attributes_(MapHandleSpAttribute()) {}
+      __map_attributes_indexes_(MapHandleIndex()),
+      __encoded_values_(std::vector<unsigned char>()),
+      __decoded_values_(std::vector<double>()),
+      __decoded_indexes_(std::vector<std::size_t>()),
+      __buffers_(std::array<Buffer, 2>()), __back_buffer_(0),
+      __extrapolators_(std::vector<Extrapolator>()),
+      __extrapolated_indexes_(std::vector<std::size_t>()) {}
 
 UpObjectInstanceSubscribed
 ObjectInstanceSubscribed::create(Name name, SpObject sp_object) {
@@ -27,25 +32,45 @@ ObjectInstanceSubscribed::create(Name name, SpObject sp_object) {
 }
 
 void ObjectInstanceSubscribed::initAttributesMap() {
-  for (auto &sp_attribute : __sp_attributes_) {
-    __map_sp_attributes_[sp_attribute->getHandle()] = sp_attribute;
+  for (auto i = 0U; i < __sp_attributes_.size(); ++i) {
+    __map_attributes_indexes_[__sp_attributes_[i]->getHandle()] = i;
+  }
+
+  __encoded_values_.resize(__sp_attributes_.size() * ByteOrder::value_size);
+  __decoded_values_.resize(__sp_attributes_.size());
+  __decoded_indexes_.resize(__sp_attributes_.size());
+  for (auto &buffer : __buffers_) {
+    buffer.values.assign(__sp_attributes_.size(), 0.);
+    buffer.times.assign(__sp_attributes_.size(), 0_s);
+    buffer.updated.assign(__sp_attributes_.size(), false);
+    buffer.indexes.assign(__sp_attributes_.size(), 0);
+    buffer.size = 0;
+    buffer.time_stamped.assign(__sp_attributes_.size(), false);
+    buffer.ordered_values.assign(__sp_attributes_.size(), 0.);
+    buffer.ordered_times.assign(__sp_attributes_.size(), 0_s);
+    buffer.ordered.assign(__sp_attributes_.size(), false);
   }
 }
 
 void ObjectInstanceSubscribed::subscribeObjectClassAttributes(
     RTI::RTIambassador *rtiAmb) {
-  rtiAmb->subscribeObjectClassAttributes(__sp_object_->getHandle(),
-                                         *__up_instance_attributes_);
-}
-
-void ObjectInstanceSubscribed::waitRegistering(RTI::RTIambassador *rtiAmb) {
-  while (!getDiscovered()) {
-    rtiAmb->tick2();
+  if (__sp_region_) {
+    rtiAmb->subscribeObjectClassAttributesWithRegion(
+        __sp_object_->getHandle(), __sp_region_->getRegion(),
+        *__up_instance_attributes_);
+  } else {
+    rtiAmb->subscribeObjectClassAttributes(__sp_object_->getHandle(),
+                                           *__up_instance_attributes_);
   }
 }
 
 void ObjectInstanceSubscribed::unsubscribe(RTI::RTIambassador *rtiAmb) {
-  rtiAmb->unsubscribeObjectClass(__sp_object_->getHandle());
+  if (__sp_region_) {
+    rtiAmb->unsubscribeObjectClassWithRegion(__sp_object_->getHandle(),
+                                             __sp_region_->getRegion());
+  } else {
+    rtiAmb->unsubscribeObjectClass(__sp_object_->getHandle());
+  }
 }
 
 void ObjectInstanceSubscribed::tryToDiscover(
@@ -61,37 +86,188 @@ void ObjectInstanceSubscribed::tryToDiscover(
 }
 
 void ObjectInstanceSubscribed::reflectAttributeValues(
-    const RTI::AttributeHandleValuePairSet &receivedAttributes) {
+    const RTI::AttributeHandleValuePairSet &receivedAttributes,
+    SeaplanesTime time, bool time_stamped) {
+#if USE_CERTI_MESSAGE_BUFFER
   RTI::ULong valueLength;
   RTI::AttributeHandle attributeHandle;
-
-#if USE_CERTI_MESSAGE_BUFFER
   libhla::MessageBuffer buffer;
-#endif // USE_CERTI_MESSAGE_BUFFER
 
   for (auto i = 0U; i < receivedAttributes.size(); ++i) {
     attributeHandle = receivedAttributes.getHandle(i);
     valueLength = receivedAttributes.getValueLength(i);
-#if USE_CERTI_MESSAGE_BUFFER
     buffer.resize(valueLength);
     buffer.reset();
     receivedAttributes.getValue(i, static_cast<char *>(buffer(0)), valueLength);
     buffer.assumeSizeFromReservedBytes();
-#else  // USE_CERTI_MESSAGE_BUFFER
-    receivedAttributes.getValue(i, static_cast<char *>(messageBuffer),
-                                valueLength);
-#endif // USE_CERTI_MESSAGE_BUFFER
 
-#if USE_CERTI_MESSAGE_BUFFER
     const double value = buffer.read_double();
     // buffer.read_doubles(&value, 0);
     mapped_attributes_[attributeHandle]->setValue(value);
+  }
 #else  // USE_CERTI_MESSAGE_BUFFER
-    // generic.
-    auto *const p_value = reinterpret_cast<double *>(messageBuffer);
-    __map_sp_attributes_[attributeHandle]->setValue(*p_value);
+  const auto count = decodeAttributeValues(receivedAttributes);
+
+  // The reader swaps the buffers between two writes only.
+  const auto back = __back_buffer_.fetch_or(writing, std::memory_order_acquire);
+  auto &buffer = __buffers_[back & 1];
+  for (auto i = 0UL; i < count; ++i) {
+    const auto index = __decoded_indexes_[i];
+    if (!buffer.updated[index]) {
+      buffer.updated[index] = true;
+      buffer.indexes[buffer.size++] = index;
+      buffer.ordered[index] = false;
+    } else if (time_stamped && !buffer.time_stamped[index]) {
+      // Kept, as the time stamped value may be discarded by a rollback.
+      buffer.ordered_values[index] = buffer.values[index];
+      buffer.ordered_times[index] = buffer.times[index];
+      buffer.ordered[index] = true;
+    }
+    if (!time_stamped) {
+      buffer.ordered[index] = false;
+    }
+    buffer.values[index] = __decoded_values_[i];
+    buffer.times[index] = time;
+    buffer.time_stamped[index] = time_stamped;
+  }
+  __back_buffer_.fetch_and(~writing, std::memory_order_release);
 #endif // USE_CERTI_MESSAGE_BUFFER
+}
+
+void ObjectInstanceSubscribed::setExtrapolation(const SpAttribute &sp_attribute,
+                                                Extrapolator::Order order) {
+  const auto index = getAttributeIndex(sp_attribute);
+  if (__extrapolators_.size() < __sp_attributes_.size()) {
+    __extrapolators_.resize(__sp_attributes_.size());
+  }
+  __extrapolators_[index] = Extrapolator(order);
+
+  const auto it = std::find(__extrapolated_indexes_.begin(),
+                            __extrapolated_indexes_.end(), index);
+  if (order == Extrapolator::Order::ZERO) {
+    if (it != __extrapolated_indexes_.end()) {
+      __extrapolated_indexes_.erase(it);
+    }
+  } else if (it == __extrapolated_indexes_.end()) {
+    __extrapolated_indexes_.push_back(index);
+  }
+}
+
+const std::vector<Extrapolator> &
+ObjectInstanceSubscribed::getExtrapolators() const {
+  return (__extrapolators_);
+}
+
+void ObjectInstanceSubscribed::setExtrapolators(
+    const std::vector<Extrapolator> &extrapolators) {
+  __extrapolators_ = extrapolators;
+}
+
+std::size_t ObjectInstanceSubscribed::swapBuffers(SeaplanesTime time) {
+  auto &buffer = takeBackBuffer();
+  const auto size = buffer.size;
+
+  for (const auto &sp_attribute : __sp_attributes_) {
+    sp_attribute->incrementAge();
+  }
+
+  for (auto i = 0UL; i < size; ++i) {
+    const auto index = buffer.indexes[i];
+    setAttributeValue(index, buffer.values[index]);
+    __sp_attributes_[index]->setReceived(buffer.times[index]);
+    if (index < __extrapolators_.size()) {
+      __extrapolators_[index].addSample(buffer.times[index],
+                                        buffer.values[index]);
+    }
+    buffer.updated[index] = false;
+  }
+  buffer.size = 0;
+
+  extrapolate(time);
+
+  return (size);
+}
+
+void ObjectInstanceSubscribed::extrapolate(SeaplanesTime time) {
+  // Extrapolated values, without changing the freshness.
+  for (const auto index : __extrapolated_indexes_) {
+    const auto &extrapolator = __extrapolators_[index];
+    if (extrapolator.empty()) {
+      continue;
+    }
+    const auto value = extrapolator.extrapolate(time);
+    if (__sp_store_) {
+      __sp_store_->setValue(__store_columns_[index], __store_slot_, value);
+    } else {
+      auto state = __sp_attributes_[index]->getState();
+      state.value.d = value;
+      __sp_attributes_[index]->setState(state);
+    }
+  }
+}
+
+void ObjectInstanceSubscribed::discardBuffers() {
+  // The front buffer is emptied by the swaps, the back buffer is written as
+  // a reflection does.
+  const auto back = __back_buffer_.fetch_or(writing, std::memory_order_acquire);
+  auto &buffer = __buffers_[back & 1];
+  auto kept = 0UL;
+  for (auto i = 0UL; i < buffer.size; ++i) {
+    const auto index = buffer.indexes[i];
+    if (buffer.time_stamped[index]) {
+      if (!buffer.ordered[index]) {
+        buffer.updated[index] = false;
+        continue;
+      }
+      buffer.values[index] = buffer.ordered_values[index];
+      buffer.times[index] = buffer.ordered_times[index];
+      buffer.time_stamped[index] = false;
+      buffer.ordered[index] = false;
+    }
+    buffer.indexes[kept++] = index;
+  }
+  buffer.size = kept;
+  __back_buffer_.fetch_and(~writing, std::memory_order_release);
+}
+
+std::size_t ObjectInstanceSubscribed::decodeAttributeValues(
+    const RTI::AttributeHandleValuePairSet &receivedAttributes) {
+  // Gather the encoded values of the known attributes.
+  auto count = 0UL;
+  for (auto i = 0U;
+       i < receivedAttributes.size() && count < __decoded_values_.size(); ++i) {
+    RTI::ULong valueLength = 0;
+    const auto *const p_value =
+        receivedAttributes.getValuePointer(i, valueLength);
+    if (valueLength != ByteOrder::value_size) {
+      continue;
+    }
+
+    const auto it =
+        __map_attributes_indexes_.find(receivedAttributes.getHandle(i));
+    if (it == __map_attributes_indexes_.end()) {
+      continue;
+    }
+    __decoded_indexes_[count] = it->second;
+    std::memcpy(__encoded_values_.data() + count * ByteOrder::value_size,
+                p_value, ByteOrder::value_size);
+    ++count;
+  }
+
+  // Decode them at once.
+  ByteOrder::decode(__encoded_values_.data(), __decoded_values_.data(), count);
+  return (count);
+}
+
+ObjectInstanceSubscribed::Buffer &ObjectInstanceSubscribed::takeBackBuffer() {
+  auto back = __back_buffer_.load(std::memory_order_relaxed);
+  while ((back & writing) != 0 ||
+         !__back_buffer_.compare_exchange_weak(back, back ^ 1,
+                                               std::memory_order_acq_rel)) {
+    std::this_thread::yield();
+    back = __back_buffer_.load(std::memory_order_relaxed);
   }
+  return (__buffers_[back & 1]);
 }
 
 } // namespace Seaplanes
@@ -0,0 +1,262 @@
+//! \file    LogicalProcessorPlacement.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor thread placement implementation.
+
+#include <LogicalProcessorLogger.h>
+#include <LogicalProcessorPlacement.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <dirent.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif // __linux__
+
+using std::ifstream;
+using std::move;
+using std::set;
+using std::string;
+using std::stringstream;
+using std::to_string;
+
+namespace Seaplanes {
+
+#ifdef __linux__
+namespace {
+
+//! \brief Check the CPUs fit in a CPU set.
+void cpusChecking(const CpuSet &cpus) {
+  for (const auto cpu : cpus) {
+    if (cpu >= CPU_SETSIZE) {
+      throw std::invalid_argument("CPU " + to_string(cpu) +
+                                  " out of the CPU set size " +
+                                  to_string(CPU_SETSIZE));
+    }
+  }
+}
+
+cpu_set_t toCpuSet(const CpuSet &cpus) {
+  cpusChecking(cpus);
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (const auto cpu : cpus) {
+    CPU_SET(cpu, &cpu_set);
+  }
+  return (cpu_set);
+}
+
+CpuSet fromCpuSet(const cpu_set_t &cpu_set) {
+  CpuSet cpus;
+  for (auto cpu = 0U; cpu < CPU_SETSIZE; ++cpu) {
+    if (CPU_ISSET(cpu, &cpu_set)) {
+      cpus.insert(cpu);
+    }
+  }
+  return (cpus);
+}
+
+//! \brief List the numerical entries of a directory (pids, tids, ...).
+set<pid_t> listPids(const string &path) {
+  set<pid_t> pids;
+  auto *const p_dir = opendir(path.c_str());
+  if (p_dir == nullptr) {
+    return (pids);
+  }
+  for (auto *p_entry = readdir(p_dir); p_entry != nullptr;
+       p_entry = readdir(p_dir)) {
+    char *p_end = nullptr;
+    const auto pid = std::strtol(p_entry->d_name, &p_end, 10);
+    if (pid > 0 && *p_end == '\0') {
+      pids.insert(static_cast<pid_t>(pid));
+    }
+  }
+  closedir(p_dir);
+  return (pids);
+}
+
+} // namespace
+#endif // __linux__
+
+Placement::Placement()
+    : __simulation_cpus_(CpuSet()), __rtia_cpus_(CpuSet()), __rtia_pid_(0) {}
+
+void Placement::setSimulationAffinity(CpuSet cpus) {
+#ifdef __linux__
+  cpusChecking(cpus);
+#endif // __linux__
+  __simulation_cpus_ = move(cpus);
+  if (!__simulation_cpus_.empty() && !pinCurrentThread(__simulation_cpus_)) {
+    Logger::get_instance().log(Logger::Level::WARN,
+                               "Simulation thread affinity not applied.");
+  }
+}
+
+void Placement::setRtiaAffinity(CpuSet cpus) {
+#ifdef __linux__
+  cpusChecking(cpus);
+#endif // __linux__
+  __rtia_cpus_ = move(cpus);
+}
+
+void Placement::apply() {
+  auto &logger = Logger::get_instance();
+
+  if (!__simulation_cpus_.empty() && !pinCurrentThread(__simulation_cpus_)) {
+    logger.log(Logger::Level::WARN, "Simulation thread affinity not applied.");
+  }
+
+  __rtia_pid_ = findRtiaPid();
+  if (!__rtia_cpus_.empty()) {
+    if (__rtia_pid_ == 0) {
+      logger.log(Logger::Level::WARN, "RTIA process not found, not pinned.");
+    } else if (!pinProcess(__rtia_pid_, __rtia_cpus_)) {
+      logger.log(Logger::Level::WARN, "RTIA affinity not applied.");
+    }
+  }
+}
+
+void Placement::report() const {
+  auto &logger = Logger::get_instance();
+#ifdef __linux__
+  const auto simulation_cpus = getCurrentThreadAffinity();
+  stringstream simulation_nodes;
+  for (const auto node : getNumaNodes(simulation_cpus)) {
+    simulation_nodes << node << " ";
+  }
+  logger.log(Logger::Level::NOTICE,
+             "Simulation thread CPUs { " + toString(simulation_cpus) +
+                 " }, running on " + to_string(sched_getcpu()) +
+                 ", NUMA nodes { " + simulation_nodes.str() + "}");
+
+  if (__rtia_pid_ != 0) {
+    const auto rtia_cpus = getProcessAffinity(__rtia_pid_);
+    stringstream rtia_nodes;
+    for (const auto node : getNumaNodes(rtia_cpus)) {
+      rtia_nodes << node << " ";
+    }
+    logger.log(Logger::Level::NOTICE,
+               "RTIA (pid " + to_string(__rtia_pid_) + ") CPUs { " +
+                   toString(rtia_cpus) + " }, NUMA nodes { " +
+                   rtia_nodes.str() + "}");
+  } else {
+    logger.log(Logger::Level::NOTICE, "RTIA process not found.");
+  }
+#else  // __linux__
+  logger.log(Logger::Level::NOTICE, "Placement not supported on this system.");
+#endif // __linux__
+}
+
+string Placement::toString(const CpuSet &cpus) {
+  stringstream stream;
+  auto first = true;
+  for (const auto cpu : cpus) {
+    stream << (first ? "" : ",") << cpu;
+    first = false;
+  }
+  return (stream.str());
+}
+
+#ifdef __linux__
+bool Placement::pinCurrentThread(const CpuSet &cpus) {
+  const auto cpu_set = toCpuSet(cpus);
+  return (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) ==
+          0);
+}
+
+bool Placement::pinProcess(const pid_t pid, const CpuSet &cpus) {
+  const auto cpu_set = toCpuSet(cpus);
+  auto pinned = true;
+  for (const auto tid : listPids("/proc/" + to_string(pid) + "/task")) {
+    pinned = (sched_setaffinity(tid, sizeof(cpu_set), &cpu_set) == 0) && pinned;
+  }
+  return (pinned);
+}
+
+CpuSet Placement::getCurrentThreadAffinity() {
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  pthread_getaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+  return (fromCpuSet(cpu_set));
+}
+
+CpuSet Placement::getProcessAffinity(const pid_t pid) {
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  sched_getaffinity(pid, sizeof(cpu_set), &cpu_set);
+  return (fromCpuSet(cpu_set));
+}
+
+set<int> Placement::getNumaNodes(const CpuSet &cpus) {
+  set<int> nodes;
+  for (const auto cpu : cpus) {
+    const auto path = "/sys/devices/system/cpu/cpu" + to_string(cpu);
+    auto *const p_dir = opendir(path.c_str());
+    if (p_dir == nullptr) {
+      continue;
+    }
+    for (auto *p_entry = readdir(p_dir); p_entry != nullptr;
+         p_entry = readdir(p_dir)) {
+      const auto entry = string(p_entry->d_name);
+      if (entry.compare(0, 4, "node") == 0 && entry.size() > 4) {
+        nodes.insert(std::atoi(entry.c_str() + 4));
+      }
+    }
+    closedir(p_dir);
+  }
+  return (nodes);
+}
+
+pid_t Placement::findRtiaPid() {
+  // CERTI forks the RTIA from the RTI ambassador constructor, it is the child
+  // process named rtia.
+  const auto self = getpid();
+  for (const auto pid : listPids("/proc")) {
+    ifstream stat("/proc/" + to_string(pid) + "/stat");
+    string line;
+    if (!std::getline(stat, line)) {
+      continue;
+    }
+    const auto comm_begin = line.find('(');
+    const auto comm_end = line.rfind(')');
+    if (comm_begin == string::npos || comm_end == string::npos) {
+      continue;
+    }
+    const auto comm = line.substr(comm_begin + 1, comm_end - comm_begin - 1);
+    stringstream fields(line.substr(comm_end + 1));
+    char state;
+    pid_t ppid = 0;
+    fields >> state >> ppid;
+    if (ppid == self && comm == "rtia") {
+      return (pid);
+    }
+  }
+  return (0);
+}
+#else  // __linux__
+bool Placement::pinCurrentThread(const CpuSet & /* cpus */) { return (false); }
+
+bool Placement::pinProcess(const pid_t /* pid */, const CpuSet & /* cpus */) {
+  return (false);
+}
+
+CpuSet Placement::getCurrentThreadAffinity() { return (CpuSet()); }
+
+CpuSet Placement::getProcessAffinity(const pid_t /* pid */) {
+  return (CpuSet());
+}
+
+set<int> Placement::getNumaNodes(const CpuSet & /* cpus */) {
+  return (set<int>());
+}
+
+pid_t Placement::findRtiaPid() { return (0); }
+#endif // __linux__
+
+} // namespace Seaplanes
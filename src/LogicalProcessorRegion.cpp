@@ -0,0 +1,80 @@
+//! \file    LogicalProcessorRegion.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor DDM region manipulation implementation.
+
+#include <LogicalProcessorRegion.h>
+
+using std::move;
+
+namespace Seaplanes {
+
+Region::Region(Name space_name, unsigned int extents_number)
+    : __space_name_(move(space_name)), __ranges_(extents_number),
+      __dimensions_handles_(std::map<Name, RTI::DimensionHandle>()),
+      __p_region_(nullptr), __modified_(false) {}
+
+SpRegion Region::create(Name space_name, unsigned int extents_number) {
+  return (SpRegion(new Region(move(space_name), extents_number)));
+}
+
+Name Region::getSpaceName() const { return (__space_name_); }
+
+void Region::setRange(const Name &dimension_name, RTI::ULong lower,
+                      RTI::ULong upper, unsigned int extent) {
+  __ranges_.at(extent)[dimension_name] = std::make_pair(lower, upper);
+
+  if (__p_region_ != nullptr) {
+    const auto dimension_handle = __dimensions_handles_.at(dimension_name);
+    __p_region_->setRangeLowerBound(extent, dimension_handle, lower);
+    __p_region_->setRangeUpperBound(extent, dimension_handle, upper);
+    __modified_ = true;
+  }
+}
+
+void Region::createRegion(RTI::RTIambassador *p_rtia) {
+  if (__p_region_ != nullptr) {
+    return;
+  }
+
+  const auto space_handle =
+      p_rtia->getRoutingSpaceHandle(__space_name_.c_str());
+  __p_region_ = p_rtia->createRegion(space_handle, __ranges_.size());
+
+  for (auto extent = 0U; extent < __ranges_.size(); ++extent) {
+    for (const auto &range : __ranges_[extent]) {
+      auto it = __dimensions_handles_.find(range.first);
+      if (it == __dimensions_handles_.end()) {
+        it = __dimensions_handles_
+                 .emplace(range.first,
+                          p_rtia->getDimensionHandle(range.first.c_str(),
+                                                     space_handle))
+                 .first;
+      }
+      __p_region_->setRangeLowerBound(extent, it->second, range.second.first);
+      __p_region_->setRangeUpperBound(extent, it->second, range.second.second);
+    }
+  }
+
+  p_rtia->notifyAboutRegionModification(*__p_region_);
+  __modified_ = false;
+}
+
+void Region::notifyModification(RTI::RTIambassador *p_rtia) {
+  if (__p_region_ != nullptr && __modified_) {
+    p_rtia->notifyAboutRegionModification(*__p_region_);
+    __modified_ = false;
+  }
+}
+
+void Region::deleteRegion(RTI::RTIambassador *p_rtia) {
+  if (__p_region_ != nullptr) {
+    p_rtia->deleteRegion(__p_region_);
+    __p_region_ = nullptr;
+  }
+}
+
+RTI::Region &Region::getRegion() const { return (*__p_region_); }
+
+} // namespace Seaplanes
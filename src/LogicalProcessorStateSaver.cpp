@@ -0,0 +1,152 @@
+//! \file    LogicalProcessorStateSaver.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor incremental state saving implementation.
+
+#include <cstring>
+
+#include <LogicalProcessorStateSaver.h>
+
+using std::move;
+
+namespace Seaplanes {
+
+namespace {
+
+bool operator!=(const Attribute::State &lhs, const Attribute::State &rhs) {
+  return (lhs.fresh != rhs.fresh || lhs.time != rhs.time ||
+          lhs.age != rhs.age ||
+          std::memcmp(&lhs.value, &rhs.value, sizeof(lhs.value)) != 0);
+}
+
+} // namespace
+
+StateSaver::StateSaver()
+    : __sp_attributes_(VecSpAttribute()),
+      __sp_stores_(VecSpObjectClassStore()),
+      __p_extrapolated_instances_(std::vector<ObjectInstanceSubscribed *>()),
+      __p_published_instances_(std::vector<ObjectInstancePublished *>()),
+      __states_(std::vector<Attribute::State>()),
+      __checkpoints_(std::deque<Checkpoint>()) {}
+
+void StateSaver::track(VecSpAttribute sp_attributes) {
+  __sp_attributes_ = move(sp_attributes);
+  __states_.clear();
+  __states_.reserve(__sp_attributes_.size());
+  for (const auto &sp_attribute : __sp_attributes_) {
+    __states_.push_back(sp_attribute->getState());
+  }
+  __checkpoints_.clear();
+}
+
+void StateSaver::trackStores(VecSpObjectClassStore sp_stores) {
+  __sp_stores_ = move(sp_stores);
+  __checkpoints_.clear();
+}
+
+void StateSaver::trackExtrapolators(
+    std::vector<ObjectInstanceSubscribed *> p_instances) {
+  __p_extrapolated_instances_ = move(p_instances);
+  __checkpoints_.clear();
+}
+
+void StateSaver::trackUpdatePolicies(
+    std::vector<ObjectInstancePublished *> p_instances) {
+  __p_published_instances_ = move(p_instances);
+  __checkpoints_.clear();
+}
+
+void StateSaver::checkpoint(SeaplanesTime time,
+                            unsigned long long step_number) {
+  Checkpoint checkpoint{time, step_number, {}, {}, {}, {}, {}};
+
+  for (auto i = 0U; i < __sp_attributes_.size(); ++i) {
+    const auto state = __sp_attributes_[i]->getState();
+    if (state != __states_[i]) {
+      checkpoint.undo.emplace_back(i, __states_[i]);
+      __states_[i] = state;
+    }
+  }
+
+  checkpoint.stores.resize(__sp_stores_.size());
+  for (auto i = 0U; i < __sp_stores_.size(); ++i) {
+    __sp_stores_[i]->getState(checkpoint.stores[i]);
+  }
+
+  checkpoint.extrapolators.reserve(__p_extrapolated_instances_.size());
+  for (const auto *const p_instance : __p_extrapolated_instances_) {
+    checkpoint.extrapolators.push_back(p_instance->getExtrapolators());
+  }
+
+  checkpoint.policies.reserve(__p_published_instances_.size());
+  for (const auto *const p_instance : __p_published_instances_) {
+    checkpoint.policies.push_back(p_instance->getUpdatePolicies());
+  }
+
+  __checkpoints_.push_back(move(checkpoint));
+}
+
+void StateSaver::recordSent(const VecEventRetractionHandle &handles) {
+  if (!__checkpoints_.empty()) {
+    auto &sent = __checkpoints_.back().sent;
+    sent.insert(sent.end(), handles.begin(), handles.end());
+  }
+}
+
+bool StateSaver::findCheckpoint(SeaplanesTime time,
+                                SeaplanesTime &checkpoint_time) const {
+  for (const auto &checkpoint : __checkpoints_) {
+    if (checkpoint.time >= time) {
+      checkpoint_time = checkpoint.time;
+      return (true);
+    }
+  }
+  return (false);
+}
+
+void StateSaver::rollback(SeaplanesTime time, unsigned long long &step_number,
+                          VecEventRetractionHandle &sent) {
+  // Discard changes done since the newest checkpoint.
+  for (auto i = 0U; i < __sp_attributes_.size(); ++i) {
+    __sp_attributes_[i]->setState(__states_[i]);
+  }
+
+  while (!__checkpoints_.empty() && __checkpoints_.back().time > time) {
+    auto &checkpoint = __checkpoints_.back();
+    for (auto it = checkpoint.undo.rbegin(); it != checkpoint.undo.rend();
+         ++it) {
+      __states_[it->first] = it->second;
+      __sp_attributes_[it->first]->setState(it->second);
+    }
+    sent.insert(sent.end(), checkpoint.sent.begin(), checkpoint.sent.end());
+    __checkpoints_.pop_back();
+  }
+
+  if (!__checkpoints_.empty()) {
+    auto &checkpoint = __checkpoints_.back();
+    sent.insert(sent.end(), checkpoint.sent.begin(), checkpoint.sent.end());
+    checkpoint.sent.clear();
+    step_number = checkpoint.step_number;
+    for (auto i = 0U; i < __sp_stores_.size(); ++i) {
+      __sp_stores_[i]->setState(checkpoint.stores[i]);
+    }
+    for (auto i = 0U; i < __p_extrapolated_instances_.size(); ++i) {
+      __p_extrapolated_instances_[i]->setExtrapolators(
+          checkpoint.extrapolators[i]);
+    }
+    for (auto i = 0U; i < __p_published_instances_.size(); ++i) {
+      __p_published_instances_[i]->setUpdatePolicies(checkpoint.policies[i]);
+    }
+  }
+}
+
+void StateSaver::fossilCollect(SeaplanesTime time) {
+  while (__checkpoints_.size() > 1 && __checkpoints_[1].time <= time) {
+    __checkpoints_.pop_front();
+  }
+}
+
+std::size_t StateSaver::size() const { return (__checkpoints_.size()); }
+
+} // namespace Seaplanes
@@ -0,0 +1,63 @@
+//! \file    LogicalProcessorStatistics.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor execution statistics implementation.
+
+#include <algorithm>
+
+#include <LogicalProcessorStatistics.h>
+
+namespace Seaplanes {
+
+Statistics::Statistics()
+    : __blocking_start_(), __compute_start_(), __blocking_number_(0),
+      __last_blocked_(0.), __max_blocked_(0.), __total_blocked_(0.),
+      __last_compute_(0.), __max_compute_(0.), __total_compute_(0.) {}
+
+void Statistics::startBlocking() { __blocking_start_ = WallClock::now(); }
+
+void Statistics::stopBlocking() {
+  __last_blocked_ = WallClock::now() - __blocking_start_;
+  __max_blocked_ = std::max(__max_blocked_, __last_blocked_);
+  __total_blocked_ += __last_blocked_;
+  ++__blocking_number_;
+}
+
+void Statistics::startCompute() { __compute_start_ = WallClock::now(); }
+
+void Statistics::stopCompute() {
+  __last_compute_ = WallClock::now() - __compute_start_;
+  __max_compute_ = std::max(__max_compute_, __last_compute_);
+  __total_compute_ += __last_compute_;
+}
+
+unsigned long long Statistics::getBlockingNumber() const {
+  return (__blocking_number_);
+}
+
+double Statistics::getLastBlockedTime() const {
+  return (__last_blocked_.count());
+}
+
+double Statistics::getMaxBlockedTime() const {
+  return (__max_blocked_.count());
+}
+
+double Statistics::getTotalBlockedTime() const {
+  return (__total_blocked_.count());
+}
+
+double Statistics::getLastComputeTime() const {
+  return (__last_compute_.count());
+}
+
+double Statistics::getMaxComputeTime() const {
+  return (__max_compute_.count());
+}
+
+double Statistics::getTotalComputeTime() const {
+  return (__total_compute_.count());
+}
+
+} // namespace Seaplanes
@@ -0,0 +1,119 @@
+//! \file    LogicalProcessorUpdatePolicy.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor published attribute update policy
+//! implementation.
+
+#include <cmath>
+
+#include <LogicalProcessorUpdatePolicy.h>
+
+namespace Seaplanes {
+
+UpdatePolicy::UpdatePolicy()
+    : UpdatePolicy(Kind::ALWAYS, 0., 1, Extrapolator::Order::ZERO) {}
+
+UpdatePolicy::UpdatePolicy(Kind kind, double threshold, unsigned int steps,
+                           Extrapolator::Order order)
+    : __kind_(kind), __threshold_(threshold), __steps_(steps), __max_age_(0),
+      __extrapolator_(Extrapolator(order)), __sent_(false), __last_(0.),
+      __age_(0), __sent_number_(0), __suppressed_number_(0),
+      __keepalives_number_(0) {}
+
+UpdatePolicy UpdatePolicy::always() { return (UpdatePolicy()); }
+
+UpdatePolicy UpdatePolicy::onChange() {
+  return (UpdatePolicy(Kind::ON_CHANGE, 0., 1, Extrapolator::Order::ZERO));
+}
+
+UpdatePolicy UpdatePolicy::deadBand(double threshold) {
+  return (
+      UpdatePolicy(Kind::DEAD_BAND, threshold, 1, Extrapolator::Order::ZERO));
+}
+
+UpdatePolicy UpdatePolicy::relativeDeadBand(double ratio) {
+  return (UpdatePolicy(Kind::RELATIVE_DEAD_BAND, ratio, 1,
+                       Extrapolator::Order::ZERO));
+}
+
+UpdatePolicy UpdatePolicy::decimation(unsigned int steps) {
+  return (
+      UpdatePolicy(Kind::DECIMATION, 0., steps, Extrapolator::Order::ZERO));
+}
+
+UpdatePolicy UpdatePolicy::deadReckoning(Extrapolator::Order order,
+                                         double threshold) {
+  return (UpdatePolicy(Kind::DEAD_RECKONING, threshold, 1, order));
+}
+
+UpdatePolicy &UpdatePolicy::setMaxAge(unsigned int steps) {
+  __max_age_ = steps;
+  return (*this);
+}
+
+UpdatePolicy::Kind UpdatePolicy::getKind() const { return (__kind_); }
+
+bool UpdatePolicy::select(double value, SeaplanesTime time) {
+  ++__age_;
+
+  auto send = !__sent_ || getChanged(value, time);
+  if (!send && __max_age_ != 0 && __age_ >= __max_age_) {
+    send = true;
+    ++__keepalives_number_;
+  }
+
+  if (!send) {
+    ++__suppressed_number_;
+    return (false);
+  }
+
+  __sent_ = true;
+  __last_ = value;
+  __age_ = 0;
+  if (__kind_ == Kind::DEAD_RECKONING) {
+    __extrapolator_.addSample(time, value);
+  }
+  ++__sent_number_;
+  return (true);
+}
+
+void UpdatePolicy::reset() {
+  __sent_ = false;
+  __last_ = 0.;
+  __age_ = 0;
+  __extrapolator_ = Extrapolator(__extrapolator_.getOrder());
+}
+
+unsigned long long UpdatePolicy::getSentNumber() const {
+  return (__sent_number_);
+}
+
+unsigned long long UpdatePolicy::getSuppressedNumber() const {
+  return (__suppressed_number_);
+}
+
+unsigned long long UpdatePolicy::getKeepalivesNumber() const {
+  return (__keepalives_number_);
+}
+
+bool UpdatePolicy::getChanged(double value, SeaplanesTime time) const {
+  switch (__kind_) {
+  case Kind::ALWAYS:
+    return (true);
+  case Kind::ON_CHANGE:
+    return (value != __last_);
+  case Kind::DEAD_BAND:
+    return (std::fabs(value - __last_) > __threshold_);
+  case Kind::RELATIVE_DEAD_BAND:
+    return (std::fabs(value - __last_) > __threshold_ * std::fabs(__last_));
+  case Kind::DECIMATION:
+    return (__age_ >= __steps_);
+  case Kind::DEAD_RECKONING:
+    return (std::fabs(value - __extrapolator_.extrapolate(time)) >
+            __threshold_);
+  }
+  return (true);
+}
+
+} // namespace Seaplanes
@@ -0,0 +1,87 @@
+//! \file    LogicalProcessorWatchdog.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Logical processor time advance watchdog implementation.
+
+#include <chrono>
+#include <string>
+
+#include <LogicalProcessorLogger.h>
+#include <LogicalProcessorWatchdog.h>
+
+using std::move;
+using std::to_string;
+
+namespace Seaplanes {
+
+UpWatchdog Watchdog::create(Name federate_name, double threshold) {
+  return (UpWatchdog(new Watchdog(move(federate_name), threshold)));
+}
+
+Watchdog::Watchdog(Name federate_name, double threshold)
+    : __federate_name_(move(federate_name)),
+      __threshold_(std::chrono::duration_cast<WallClock::duration>(
+          std::chrono::duration<double>(threshold))),
+      __mutex_(), __cv_(), __running_(true), __armed_(false), __armed_at_(),
+      __requested_time_(0_s), __granted_time_(0_s), __step_number_(0),
+      __thread_(&Watchdog::watch, this) {}
+
+Watchdog::~Watchdog() {
+  {
+    std::lock_guard<std::mutex> lock(__mutex_);
+    __running_ = false;
+  }
+  __cv_.notify_one();
+  __thread_.join();
+}
+
+void Watchdog::arm(SeaplanesTime requested_time, SeaplanesTime granted_time,
+                   unsigned long long step_number) {
+  {
+    std::lock_guard<std::mutex> lock(__mutex_);
+    __armed_ = true;
+    __armed_at_ = WallClock::now();
+    __requested_time_ = requested_time;
+    __granted_time_ = granted_time;
+    __step_number_ = step_number;
+  }
+  __cv_.notify_one();
+}
+
+void Watchdog::disarm() {
+  std::lock_guard<std::mutex> lock(__mutex_);
+  __armed_ = false;
+}
+
+void Watchdog::watch() {
+  std::unique_lock<std::mutex> lock(__mutex_);
+
+  while (__running_) {
+    if (!__armed_) {
+      __cv_.wait(lock);
+      continue;
+    }
+
+    // Wake up at each threshold multiple, while the same request is pending.
+    const auto armed_at = __armed_at_;
+    auto deadline = armed_at + __threshold_;
+    while (__running_ && __armed_ && __armed_at_ == armed_at) {
+      if (__cv_.wait_until(lock, deadline) != std::cv_status::timeout) {
+        continue;
+      }
+      const std::chrono::duration<double> pending =
+          WallClock::now() - armed_at;
+      Logger::get_instance().log(
+          Logger::Level::WARN,
+          "Watchdog: " + __federate_name_ + " waiting for TAG " +
+              to_string(__requested_time_.get_s()) + "s since " +
+              to_string(pending.count()) + "s (step " +
+              to_string(__step_number_) + ", last grant " +
+              to_string(__granted_time_.get_s()) + "s)");
+      deadline += __threshold_;
+    }
+  }
+}
+
+} // namespace Seaplanes
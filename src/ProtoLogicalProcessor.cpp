@@ -4,14 +4,21 @@
 //! \date    July 2016
 //! \brief   Common interface to federates implementation.
 
+#include <algorithm>
+#include <cassert>
+#include <chrono>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
 #include <ostream>
+#include <stdexcept>
 #include <string>
 #include <unistd.h>
 
+#include <LogicalProcessorByteOrder.h>
 #include <ProtoLogicalProcessor.h>
+#include <TimeManagementPolicyAdaptive.h>
+#include <TimeManagementPolicyOptimistic.h>
 #include <TimeManagementPolicyTimeStep.h>
 
 #ifndef FEDERATION_SYNC_POINT_NAME
@@ -23,9 +30,16 @@ using std::move;
 using std::ofstream;
 using std::ostream;
 using std::string;
-using std::stringstream;
 using std::to_string;
 
+namespace {
+
+//! Time waited for messages by a tick, while waiting for discoveries with a
+//! timeout, in seconds.
+constexpr double discovery_tick_time = 1e-2;
+
+} // namespace
+
 namespace Seaplanes {
 
 ProtoLogicalProcessor::ProtoLogicalProcessor(
@@ -39,18 +53,44 @@ ProtoLogicalProcessor::ProtoLogicalProcessor(
       __ask_time_regulator_(true), __ask_time_constrained_(true),
       __is_time_regulator_(false), __is_time_constrained_(false),
       __has_time_advance_grant_(false), __local_time_(0_s),
+      __granted_time_(0_s),
       __time_step_(timestep), __lookahead_(lookahead),
       __time_limit_(time_limit), __is_creator_(false), __step_number_(0),
-      __sync_reg_success_(false), __sync_reg_failed_(false), __in_pause_(false),
+      __sub_steps_number_(1), __sub_step_index_(0), __sync_reg_success_(false),
+      __sync_reg_failed_(false), __in_pause_(false),
+      __placement_(Placement()), __statistics_(Statistics()),
+      __up_watchdog_(nullptr), __relevance_advisories_(false),
+      __sp_statistics_attributes_(VecSpAttribute()),
+      __model_scheduler_(ModelScheduler()), __up_executor_(nullptr),
+      __io_thread_enabled_(false), __io_tick_time_(0.),
+      __up_io_thread_(nullptr), __up_metrics_(nullptr),
+      __up_allocation_(nullptr), __models_profile_path_(Name()),
       __up_time_management_policy_(
           TimeManagementPolicyFactory::create<TimeManagementPolicyTimeStep>(
               *this)),
       __logger_(Logger::get_instance(p_log_stream)), __uav_index_(0),
-      __up_rav_tags_(VecUpTag()), __sp_object_classes_(VecSpObject()),
+      __sent_retraction_handles_(VecEventRetractionHandle()),
+      __uav_tag_(Tag()), __rav_tags_(VecTag()), __rav_tags_number_(0),
+      __allocation_warmup_steps_(10), __sp_object_classes_(VecSpObject()),
       __sp_subscribed_objects_(VecSpObjectInstanceSubscribed()),
       __up_published_objects_(VecUpObjectInstancePublished()),
       __map_sp_subscribed_objects_(MapHandleSpObjectInstanceSubscribed()),
-      __timer_simu_start_(0), __timer_simu_end_(0) {}
+      __map_undiscovered_objects_(MultimapNameSpObjectInstanceSubscribed()),
+      __discovery_timeout_(0.),
+      __sp_published_interactions_(VecSpInteractionClass()),
+      __sp_subscribed_interactions_(VecSpInteractionClass()),
+      __map_sp_subscribed_interactions_(MapHandleSpInteractionClass()),
+      __interactions_to_send_(VecInteraction()),
+      __interactions_to_send_number_(0),
+      __received_interactions_(VecInteraction()),
+      __received_interactions_number_(0),
+      __incoming_interactions_(VecInteraction()),
+      __incoming_interactions_number_(0), __up_parameters_(nullptr),
+      __encoded_parameters_(std::vector<unsigned char>()),
+      __timer_simu_start_(0), __timer_simu_end_(0) {
+  // Room for the federate name, the separator, and the UAV index.
+  __uav_tag_.reserve(__federate_name_.size() + 1 + 20);
+}
 
 ProtoLogicalProcessor::ProtoLogicalProcessor(Name federate_name,
                                              double timeLimit, double timeStep,
@@ -88,15 +128,131 @@ void ProtoLogicalProcessor::addPublishedObject(
 
 void ProtoLogicalProcessor::addSubscribedObject(
     SpObjectInstanceSubscribed sp_instance) {
+  __map_undiscovered_objects_.emplace(sp_instance->getName(), sp_instance);
   __sp_subscribed_objects_.push_back(move(sp_instance));
 }
 
+void ProtoLogicalProcessor::addPublishedInteraction(
+    SpInteractionClass sp_interaction_class) {
+  __sp_published_interactions_.push_back(move(sp_interaction_class));
+}
+
+void ProtoLogicalProcessor::addSubscribedInteraction(
+    SpInteractionClass sp_interaction_class) {
+  __sp_subscribed_interactions_.push_back(move(sp_interaction_class));
+}
+
+void ProtoLogicalProcessor::sendInteraction(const Interaction &interaction) {
+  const auto &sp_interaction_class = interaction.getInteractionClass();
+  if (std::find(__sp_published_interactions_.begin(),
+                __sp_published_interactions_.end(),
+                sp_interaction_class) == __sp_published_interactions_.end()) {
+    throw std::invalid_argument("Interaction class not published " +
+                                sp_interaction_class->getName());
+  }
+
+  // Queue storage is reused, only growing during the first steps.
+  if (__interactions_to_send_number_ == __interactions_to_send_.size()) {
+    __interactions_to_send_.push_back(interaction);
+  } else {
+    __interactions_to_send_[__interactions_to_send_number_] = interaction;
+  }
+  ++__interactions_to_send_number_;
+}
+
+std::size_t ProtoLogicalProcessor::getReceivedInteractionsNumber() const {
+  return (__received_interactions_number_);
+}
+
+const Interaction &
+ProtoLogicalProcessor::getReceivedInteraction(std::size_t index) const {
+  return (__received_interactions_[index]);
+}
+
+void ProtoLogicalProcessor::addModel(SpModel sp_model) {
+  if (__up_allocation_) {
+    const auto &models =
+        __up_allocation_->findPartition(__federate_name_)->models;
+    if (std::find(models.begin(), models.end(), sp_model->getName()) ==
+        models.end()) {
+      __logger_ << "model " + sp_model->getName() + " allocated to another LP";
+      return;
+    }
+  }
+  __model_scheduler_.addModel(move(sp_model));
+}
+
+void ProtoLogicalProcessor::setAllocation(const Name &path) {
+  if (!__model_scheduler_.getModels().empty()) {
+    throw std::logic_error("Allocation set after models were added");
+  }
+
+  auto up_allocation = Allocation::create(path);
+  const auto *const p_partition =
+      up_allocation->findPartition(__federate_name_);
+  if (p_partition == nullptr) {
+    throw std::invalid_argument("No partition of " + __federate_name_ +
+                                " in allocation " + path);
+  }
+  if (p_partition->cpu >= 0) {
+    setSimulationAffinity(CpuSet{static_cast<unsigned int>(p_partition->cpu)});
+  }
+  __up_allocation_ = move(up_allocation);
+}
+
+void ProtoLogicalProcessor::setModelsProfile(const Name &path) {
+  __models_profile_path_ = path;
+  __model_scheduler_.enableProfiling();
+}
+
+void ProtoLogicalProcessor::setModelsThreads(unsigned int threads_number,
+                                             bool deterministic) {
+  __up_executor_ = Executor::create(threads_number, deterministic);
+}
+
+void ProtoLogicalProcessor::enableIoThread(double tick_time) {
+  __io_thread_enabled_ = true;
+  __io_tick_time_ = tick_time;
+}
+
+void ProtoLogicalProcessor::setDiscoveryTimeout(double timeout) {
+  __discovery_timeout_ = timeout;
+}
+
+void ProtoLogicalProcessor::setSubSteps(unsigned int sub_steps_number) {
+  if (dynamic_cast<TimeManagementPolicyAdaptive *>(
+          __up_time_management_policy_.get()) != nullptr) {
+    throw std::logic_error(
+        "Sub-steps are not supported by the adaptive time management policy");
+  }
+  if (sub_steps_number == 0 ||
+      __time_step_.get_us() % sub_steps_number != 0) {
+    throw std::invalid_argument(
+        "Time step of " + to_string(__time_step_.get_us()) +
+        "us not divided in " + to_string(sub_steps_number) + " sub-steps");
+  }
+  __sub_steps_number_ = sub_steps_number;
+}
+
+void ProtoLogicalProcessor::enableMetrics() {
+  __up_metrics_ = Metrics::create(__federate_name_);
+  __up_metrics_->getSnapshot().time_limit = __time_limit_.get_s();
+  __logger_ << "Metrics in " + __up_metrics_->getName();
+}
+
 inline void ProtoLogicalProcessor::creationPhase() {
   __logger_.log(Logger::Level::NOTICE, __func__);
+  threadsPlacement();
   federationCreation();
   federationJoin();
 }
 
+inline void ProtoLogicalProcessor::threadsPlacement() {
+  __logger_ << __func__;
+  __placement_.apply();
+  __placement_.report();
+}
+
 inline void ProtoLogicalProcessor::federationCreation() {
   __logger_ << __func__;
   try {
@@ -118,6 +274,7 @@ inline void ProtoLogicalProcessor::federationJoin() {
 void ProtoLogicalProcessor::initializationPhase() {
   __logger_.log(Logger::Level::NOTICE, __func__);
   attributesAndObjectsHandlesFetching();
+  modelsOrdering();
   declarationOfPublicationAndSubscription();
   initializingTimeManagementPolicy();
   synchronization();
@@ -150,6 +307,102 @@ inline void ProtoLogicalProcessor::attributesAndObjectsHandlesFetching() {
                      to_string(sp_subscribed_object->getHandle());
     sp_subscribed_object->initAttributesMap();
   }
+
+  for (auto &sp_interaction_class : __sp_published_interactions_) {
+    sp_interaction_class->setHandles(&__rti_amb_);
+    __logger_ << "interaction published " + sp_interaction_class->getName() +
+                     " handle " + to_string(sp_interaction_class->getHandle());
+  }
+
+  for (auto &sp_interaction_class : __sp_subscribed_interactions_) {
+    sp_interaction_class->setHandles(&__rti_amb_);
+    __logger_ << "interaction subscribed " + sp_interaction_class->getName() +
+                     " handle " + to_string(sp_interaction_class->getHandle());
+    __map_sp_subscribed_interactions_[sp_interaction_class->getHandle()] =
+        sp_interaction_class;
+  }
+
+  regionsCreation();
+}
+
+inline void ProtoLogicalProcessor::regionsCreation() {
+  for (const auto &up_published_object : __up_published_objects_) {
+    if (up_published_object->getRegion()) {
+      __logger_ << "region of " + up_published_object->getName() + " in " +
+                       up_published_object->getRegion()->getSpaceName();
+      up_published_object->getRegion()->createRegion(&__rti_amb_);
+    }
+  }
+
+  for (const auto &sp_subscribed_object : __sp_subscribed_objects_) {
+    if (sp_subscribed_object->getRegion()) {
+      __logger_ << "region of " + sp_subscribed_object->getName() + " in " +
+                       sp_subscribed_object->getRegion()->getSpaceName();
+      sp_subscribed_object->getRegion()->createRegion(&__rti_amb_);
+    }
+  }
+}
+
+inline void ProtoLogicalProcessor::modelsOrdering() {
+  __logger_ << __func__;
+  __model_scheduler_.order();
+
+  const auto &sp_models = __model_scheduler_.getModels();
+  for (const auto model : __model_scheduler_.getOrder()) {
+    __logger_ << "model " + sp_models[model]->getName();
+  }
+
+  if (__up_executor_) {
+    __up_executor_->setup(__model_scheduler_);
+    __logger_ << "models threads " +
+                     to_string(__up_executor_->getThreadsNumber());
+  }
+}
+
+void ProtoLogicalProcessor::subStepsCalculation() {
+  if (__sub_steps_number_ == 1) {
+    localsCalculation(); // Specialized by the federate.
+    return;
+  }
+
+  // The updates are sent, and the time advanced, from the step time.
+  const auto step_time = __local_time_;
+  const auto sub_step_us = getSubStep().get_us();
+  for (__sub_step_index_ = 0; __sub_step_index_ < __sub_steps_number_;
+       ++__sub_step_index_) {
+    if (__sub_step_index_ > 0) {
+      __local_time_ =
+          SeaplanesTime(step_time.get_us() + __sub_step_index_ * sub_step_us);
+      for (const auto &sp_subscribed_object : __sp_subscribed_objects_) {
+        sp_subscribed_object->extrapolate(__local_time_);
+      }
+    }
+    localsCalculation(); // Specialized by the federate.
+  }
+  __sub_step_index_ = 0;
+  __local_time_ = step_time;
+}
+
+void ProtoLogicalProcessor::localsCalculation() {
+  if (__up_executor_) {
+    __up_executor_->run();
+  } else {
+    __model_scheduler_.run();
+  }
+}
+
+inline void ProtoLogicalProcessor::regionsModification() {
+  for (const auto &up_published_object : __up_published_objects_) {
+    if (up_published_object->getRegion()) {
+      up_published_object->getRegion()->notifyModification(&__rti_amb_);
+    }
+  }
+
+  for (const auto &sp_subscribed_object : __sp_subscribed_objects_) {
+    if (sp_subscribed_object->getRegion()) {
+      sp_subscribed_object->getRegion()->notifyModification(&__rti_amb_);
+    }
+  }
 }
 
 inline void ProtoLogicalProcessor::declarationOfPublicationAndSubscription() {
@@ -161,15 +414,65 @@ inline void ProtoLogicalProcessor::declarationOfPublicationAndSubscription() {
     sp_subscribed_object->subscribeObjectClassAttributes(&__rti_amb_);
   }
 
+  if (__relevance_advisories_) {
+    __logger_ << "enabling relevance advisories";
+    __rti_amb_.enableClassRelevanceAdvisorySwitch();
+    __rti_amb_.enableAttributeRelevanceAdvisorySwitch();
+    for (auto &up_publishedObject : __up_published_objects_) {
+      up_publishedObject->setRelevanceAdvised();
+    }
+  }
+
   __logger_ << "publishing objects";
   for (auto &up_publishedObject : __up_published_objects_) {
     __logger_ << "publishing: " + up_publishedObject->getName();
     up_publishedObject->publishObjectClass(&__rti_amb_);
   }
+  // An update per transport, at most.
+  __sent_retraction_handles_.reserve(2 * __up_published_objects_.size());
+
+  __logger_ << "subscribing and publishing interactions";
+  for (auto &sp_interaction_class : __sp_subscribed_interactions_) {
+    sp_interaction_class->subscribe(&__rti_amb_);
+  }
+  auto parameters_number = 0UL;
+  for (auto &sp_interaction_class : __sp_published_interactions_) {
+    sp_interaction_class->publish(&__rti_amb_);
+    parameters_number = std::max(parameters_number,
+                                 sp_interaction_class->getParametersNumber());
+  }
+  __up_parameters_.reset(RTI::ParameterSetFactory::create(parameters_number));
+  __encoded_parameters_.resize(parameters_number * ByteOrder::value_size);
 }
 
 inline void ProtoLogicalProcessor::initializingTimeManagementPolicy() {
   __logger_ << __func__;
+  // The optimistic policy logs, retracts and rolls back reflections only:
+  // interactions would be consumed ahead of their time stamps, and lost by the
+  // rollbacks and the retractions. Receive order updates, sent without
+  // retraction handle, could not be undone by the rollbacks.
+  if (dynamic_cast<TimeManagementPolicyOptimistic *>(
+          __up_time_management_policy_.get()) != nullptr) {
+    if (!__sp_subscribed_interactions_.empty()) {
+      throw std::logic_error(
+          "Subscribed interactions are not supported by the optimistic time "
+          "management policy");
+    }
+    for (const auto &up_published_object : __up_published_objects_) {
+      if (up_published_object->hasReceiveOrder()) {
+        throw std::logic_error(
+            "Receive order attributes of " + up_published_object->getName() +
+            " are not supported by the optimistic time management policy");
+      }
+    }
+  }
+  // The sub-steps divide the fixed time step, not the adaptive steps.
+  if (__sub_steps_number_ > 1 &&
+      dynamic_cast<TimeManagementPolicyAdaptive *>(
+          __up_time_management_policy_.get()) != nullptr) {
+    throw std::logic_error(
+        "Sub-steps are not supported by the adaptive time management policy");
+  }
   __up_time_management_policy_->initializing();
 }
 
@@ -227,21 +530,55 @@ inline void ProtoLogicalProcessor::synchronization() {
 inline void ProtoLogicalProcessor::registeringObjects() {
   __logger_ << __func__;
 
+  // Registered in a row, the discoveries being waited for at once after.
   for (auto &up_published_object : __up_published_objects_) {
     __logger_ << "Registering: " + up_published_object->getName();
     up_published_object->registering(&__rti_amb_);
   }
 
-  for (auto &sp_subscribed_object : __sp_subscribed_objects_) {
-    __logger_ << "Waiting for registering of: " +
-                     sp_subscribed_object->getName();
-    sp_subscribed_object->waitRegistering(&__rti_amb_);
+  discoveryWaiting();
+}
+
+void ProtoLogicalProcessor::discoveryWaiting() {
+  using Clock = std::chrono::steady_clock;
+  const auto start = Clock::now();
+  const auto timeout = std::chrono::duration<double>(__discovery_timeout_);
+
+  __logger_ << "Waiting for the discovery of " +
+                   to_string(__map_undiscovered_objects_.size()) + " of " +
+                   to_string(__sp_subscribed_objects_.size()) +
+                   " object instances";
+
+  while (!__map_undiscovered_objects_.empty()) {
+    if (__discovery_timeout_ > 0.) {
+      if (Clock::now() - start >= timeout) {
+        break;
+      }
+      __rti_amb_.tick(discovery_tick_time, discovery_tick_time);
+    } else {
+      __rti_amb_.tick2();
+    }
   }
 
-  for (auto &sp_subscribed_object : __sp_subscribed_objects_) {
-    __logger_ << sp_subscribed_object->getName() + " discovered ? " +
-                     to_string(sp_subscribed_object->getDiscovered());
+  const auto elapsed =
+      std::chrono::duration<double>(Clock::now() - start).count();
+  if (__map_undiscovered_objects_.empty()) {
+    __logger_.log(Logger::Level::NOTICE,
+                  to_string(__sp_subscribed_objects_.size()) +
+                      " object instances discovered in " + to_string(elapsed) +
+                      "s.");
+    return;
   }
+
+  string missing;
+  for (const auto &undiscovered : __map_undiscovered_objects_) {
+    missing += (missing.empty() ? "" : ", ") + undiscovered.first;
+  }
+  __logger_.log(Logger::Level::ERROR,
+                to_string(__map_undiscovered_objects_.size()) +
+                    " object instances not discovered in " +
+                    to_string(elapsed) + "s: " + missing);
+  throw std::runtime_error("Object instances not discovered: " + missing);
 }
 
 inline void ProtoLogicalProcessor::simulationLoopPhase() {
@@ -249,17 +586,40 @@ inline void ProtoLogicalProcessor::simulationLoopPhase() {
 
   time(&__timer_simu_start_);
 
+  if (__io_thread_enabled_) {
+    __up_io_thread_ = IoThread::create(__rti_amb_, __io_tick_time_);
+  }
+  if (__up_metrics_) {
+    __up_metrics_->start();
+  }
+
   while (__local_time_ < __time_limit_) {
+    const auto allocations = AllocationCounter::get();
     ++__step_number_;
     updatesReception();
+    if (__up_metrics_) {
+      __up_metrics_->mark(Metrics::Phase::RECEPTION);
+    }
     logPreLocalsCalculation();
-    localsCalculation(); // Specialized by the federate.
+    __statistics_.startCompute();
+    subStepsCalculation();
+    __statistics_.stopCompute();
     logPostLocalsCalculation();
+    if (__up_metrics_) {
+      __up_metrics_->mark(Metrics::Phase::CALCULATION);
+    }
     // so the method could be pure.
     updatesSending();
+    if (__up_metrics_) {
+      __up_metrics_->mark(Metrics::Phase::SENDING);
+    }
     timeAdvance();
+    metricsPublishing();
+    allocationsCheck(allocations);
   }
 
+  __up_io_thread_.reset();
+
   time(&__timer_simu_end_);
 
   __logger_.log(Logger::Level::NOTICE,
@@ -269,29 +629,134 @@ inline void ProtoLogicalProcessor::simulationLoopPhase() {
 
 inline void ProtoLogicalProcessor::updatesReception() {
   __logger_ << __func__;
-  // Nothing to do.
+
+  auto values = 0UL;
+  for (const auto &sp_subscribed_object : __sp_subscribed_objects_) {
+    values += sp_subscribed_object->swapBuffers(__local_time_);
+  }
+
+  if (!__sp_subscribed_interactions_.empty()) {
+    // The queues are swapped, the I/O thread receiving between two ticks.
+    IoThread::Lock lock(__up_io_thread_.get());
+    std::swap(__received_interactions_, __incoming_interactions_);
+    __received_interactions_number_ = __incoming_interactions_number_;
+    __incoming_interactions_number_ = 0;
+  }
+
+  if (__logger_.isLogging()) {
+    __logger_ << "values received " + to_string(values);
+    __logger_ << "interactions received " +
+                     to_string(__received_interactions_number_);
+  }
+}
+
+void ProtoLogicalProcessor::reflectionsDiscarding() {
+  for (const auto &sp_subscribed_object : __sp_subscribed_objects_) {
+    sp_subscribed_object->discardBuffers();
+  }
+  __incoming_interactions_number_ = 0;
 }
 
 inline void ProtoLogicalProcessor::updatesSending() {
   __logger_ << __func__;
-  stringstream tag;
   const auto timeStamp = __local_time_ + __lookahead_;
 
-  tag << __federate_name_ << "." << __uav_index_;
+  // Built in place, the index fitting in the small string buffer.
+  __uav_tag_.assign(__federate_name_);
+  __uav_tag_ += '.';
+  __uav_tag_ += to_string(__uav_index_);
+
+  if (__logger_.isLogging()) {
+    __logger_ << "preUAV\t" + __uav_tag_ + "\t( " +
+                     to_string(__local_time_.get_s()) + ",\t" +
+                     to_string(timeStamp.get_s()) + ")";
+  }
+
+  statisticsUpdate();
 
-  __logger_ << "preUAV\t" + tag.str() + "\t( " +
-                   to_string(__local_time_.get_s()) + ",\t" +
-                   to_string(timeStamp.get_s()) + ")";
+  IoThread::Lock lock(__up_io_thread_.get());
+  regionsModification();
 
+  const auto fed_time = static_cast<RTIfedTime>(timeStamp.get_us());
+  __sent_retraction_handles_.clear();
   for (auto &up_published_object : __up_published_objects_) {
-    // might need a small improvement later.
-    up_published_object->updateAttributeValues(
-        &__rti_amb_, &__certi_message_buffer_, timeStamp.get_us(), tag.str());
+    if (!up_published_object->selectUpdates(fed_time)) {
+      continue;
+    }
+    const auto receive_ordered_values =
+        up_published_object->getReceiveOrderUpdateSize();
+    const auto time_stamped_values = up_published_object->getUpdateSize();
+    // Receive order values first, not waiting for any grant.
+    if (receive_ordered_values != 0) {
+      up_published_object->updateReceiveOrderValues(
+          &__rti_amb_, &__certi_message_buffer_, fed_time, __uav_tag_);
+    }
+    // Time stamped values in an update per transport.
+    for (const auto transport : {Transport::RELIABLE, Transport::BEST_EFFORT}) {
+      if (up_published_object->getUpdateSize(transport) != 0) {
+        __sent_retraction_handles_.push_back(
+            up_published_object->updateAttributeValues(
+                &__rti_amb_, &__certi_message_buffer_, fed_time, __uav_tag_,
+                transport));
+      }
+    }
+    if (__up_metrics_) {
+      const auto values = receive_ordered_values + time_stamped_values;
+      __up_metrics_->countSent(values, values * ByteOrder::value_size);
+    }
   }
 
+  interactionsSending(fed_time);
+
   __uav_index_++;
 }
 
+void ProtoLogicalProcessor::interactionsSending(const RTIfedTime &time) {
+  for (auto i = 0UL; i < __interactions_to_send_number_; ++i) {
+    const auto &interaction = __interactions_to_send_[i];
+    interaction.encodeParameters(*__up_parameters_, __encoded_parameters_);
+    RTI::EventRetractionHandle handle{};
+    {
+      AllocationCounter::Exclusion exclusion;
+      handle = __rti_amb_.sendInteraction(
+          interaction.getInteractionClass()->getHandle(), *__up_parameters_,
+          time, __uav_tag_.c_str());
+    }
+    __sent_retraction_handles_.push_back(handle);
+    if (__up_metrics_) {
+      const auto values = __up_parameters_->size();
+      __up_metrics_->countSent(values, values * ByteOrder::value_size);
+    }
+  }
+  __interactions_to_send_number_ = 0;
+}
+
+inline void ProtoLogicalProcessor::metricsPublishing() {
+  if (!__up_metrics_) {
+    return;
+  }
+  __up_metrics_->mark(Metrics::Phase::TIME_ADVANCE);
+
+  auto &snapshot = __up_metrics_->getSnapshot();
+  snapshot.step_number = __step_number_;
+  snapshot.local_time = __local_time_.get_s();
+  snapshot.grant_wait_time = __statistics_.getLastBlockedTime();
+  snapshot.max_grant_wait_time = __statistics_.getMaxBlockedTime();
+  __up_metrics_->publish();
+}
+
+inline void ProtoLogicalProcessor::statisticsUpdate() {
+  if (__sp_statistics_attributes_.empty()) {
+    return;
+  }
+  __sp_statistics_attributes_[0]->setValue(__statistics_.getLastBlockedTime());
+  __sp_statistics_attributes_[1]->setValue(__statistics_.getLastComputeTime());
+  __sp_statistics_attributes_[2]->setValue(
+      __statistics_.getTotalBlockedTime());
+  __sp_statistics_attributes_[3]->setValue(
+      __statistics_.getTotalComputeTime());
+}
+
 inline void ProtoLogicalProcessor::timeAdvance() {
   __logger_ << __func__;
   __up_time_management_policy_->timeAdvance();
@@ -300,10 +765,85 @@ inline void ProtoLogicalProcessor::timeAdvance() {
 inline void ProtoLogicalProcessor::endingPhase() {
   __logger_.log(Logger::Level::NOTICE, __func__);
 
+  stalenessLogging();
+  updatePoliciesLogging();
+  modelsProfileWriting();
   deletingRegisteredObjects();
   deactivatingTimeManagementPolicy();
 }
 
+inline void ProtoLogicalProcessor::stalenessLogging() {
+  for (const auto &sp_model : __model_scheduler_.getModels()) {
+    sp_model->readsAccounting();
+  }
+  for (const auto &sp_subscribed_object : __sp_subscribed_objects_) {
+    for (const auto &sp_attribute : sp_subscribed_object->getAttributes()) {
+      const auto &staleness = sp_attribute->getStaleness();
+      if (staleness.reads == 0) {
+        continue;
+      }
+      __logger_ << "staleness " + sp_subscribed_object->getName() + "." +
+                       sp_attribute->getName() + " updates " +
+                       to_string(staleness.updates) + ", reads " +
+                       to_string(staleness.reads) + " (" +
+                       to_string(staleness.stale_reads) + " stale), age " +
+                       to_string(static_cast<double>(staleness.ages_sum) /
+                                 staleness.reads) +
+                       " steps (max " + to_string(staleness.max_age) + ")";
+    }
+  }
+}
+
+inline void ProtoLogicalProcessor::updatePoliciesLogging() {
+  for (const auto &up_published_object : __up_published_objects_) {
+    const auto &sp_attributes = up_published_object->getAttributes();
+    const auto &policies = up_published_object->getUpdatePolicies();
+    for (auto i = 0U; i < policies.size(); ++i) {
+      if (policies[i].getSuppressedNumber() == 0) {
+        continue;
+      }
+      __logger_ << "updates " + up_published_object->getName() + "." +
+                       sp_attributes[i]->getName() + " sent " +
+                       to_string(policies[i].getSentNumber()) + " (" +
+                       to_string(policies[i].getKeepalivesNumber()) +
+                       " keepalives), suppressed " +
+                       to_string(policies[i].getSuppressedNumber());
+    }
+  }
+}
+
+inline void ProtoLogicalProcessor::modelsProfileWriting() {
+  if (__models_profile_path_.empty()) {
+    return;
+  }
+  ofstream file(__models_profile_path_);
+  if (!file) {
+    __logger_.log(Logger::Level::WARN,
+                  "Cannot write models profile " + __models_profile_path_);
+    return;
+  }
+
+  // Models run at each sub-step.
+  const auto period = getSubStep().get_s();
+  const auto &sp_models = __model_scheduler_.getModels();
+  file << "# Seaplanes models profile of " << __federate_name_ << "\n";
+  for (auto i = 0UL; i < sp_models.size(); ++i) {
+    const auto name = sp_models[i]->getName();
+    file << "model " << name << ' '
+         << __model_scheduler_.getMeanComputeTime(i) << ' ' << period << '\n';
+    for (const auto &sp_input : sp_models[i]->getInputs()) {
+      file << "input " << name << ' ' << sp_input->getName() << '\n';
+    }
+    for (const auto &sp_input : sp_models[i]->getDelayedInputs()) {
+      file << "input " << name << ' ' << sp_input->getName() << '\n';
+    }
+    for (const auto &sp_output : sp_models[i]->getOutputs()) {
+      file << "output " << name << ' ' << sp_output->getName() << '\n';
+    }
+  }
+  __logger_ << "Models profile in " + __models_profile_path_;
+}
+
 inline void ProtoLogicalProcessor::deletingRegisteredObjects() {
   __logger_ << __func__;
 
@@ -315,11 +855,38 @@ inline void ProtoLogicalProcessor::deletingRegisteredObjects() {
     up_published_object->publishObjectClass(&__rti_amb_);
     up_published_object->unpublish(&__rti_amb_);
   }
+
+  for (auto &up_published_object : __up_published_objects_) {
+    if (up_published_object->getRegion()) {
+      up_published_object->getRegion()->deleteRegion(&__rti_amb_);
+    }
+  }
+
+  for (auto &sp_interaction_class : __sp_subscribed_interactions_) {
+    sp_interaction_class->unsubscribe(&__rti_amb_);
+  }
+
+  for (auto &sp_interaction_class : __sp_published_interactions_) {
+    sp_interaction_class->unpublish(&__rti_amb_);
+  }
+
+  for (auto &sp_subscribed_object : __sp_subscribed_objects_) {
+    if (sp_subscribed_object->getRegion()) {
+      sp_subscribed_object->getRegion()->deleteRegion(&__rti_amb_);
+    }
+  }
 }
 
 inline void ProtoLogicalProcessor::deactivatingTimeManagementPolicy() {
   __logger_ << __func__;
   __up_time_management_policy_->deactivating();
+  __logger_.log(
+      Logger::Level::NOTICE,
+      "Blocked " + to_string(__statistics_.getTotalBlockedTime()) + "s (max " +
+          to_string(__statistics_.getMaxBlockedTime()) + "s, " +
+          to_string(__statistics_.getBlockingNumber()) + " waits), computed " +
+          to_string(__statistics_.getTotalComputeTime()) + "s (max " +
+          to_string(__statistics_.getMaxComputeTime()) + "s)");
 }
 
 inline void ProtoLogicalProcessor::deletingPhase() {
@@ -354,16 +921,35 @@ inline void ProtoLogicalProcessor::federationDestruction() {
 }
 
 inline void ProtoLogicalProcessor::logPreLocalsCalculation() {
-  for (const auto &up_rav_tag : __up_rav_tags_) {
-    __logger_ << "sRAV\t" + (*up_rav_tag) + "\t(" +
+  for (auto i = 0UL; i < __rav_tags_number_; ++i) {
+    __logger_ << "sRAV\t" + __rav_tags_[i] + "\t(" +
                      to_string(__local_time_.get_s()) + ")";
   }
-  __up_rav_tags_.clear();
+  __rav_tags_number_ = 0;
 }
 
 inline void ProtoLogicalProcessor::logPostLocalsCalculation() {
-  __logger_ << "sUAV\t" + __federate_name_ + "." + to_string(__uav_index_) +
-                   "\t(" + to_string(__local_time_.get_s()) + ")";
+  if (__logger_.isLogging()) {
+    __logger_ << "sUAV\t" + __federate_name_ + "." + to_string(__uav_index_) +
+                     "\t(" + to_string(__local_time_.get_s()) + ")";
+  }
+}
+
+inline void
+ProtoLogicalProcessor::allocationsCheck(unsigned long long allocations) {
+  if (!AllocationCounter::isEnabled() ||
+      __step_number_ <= __allocation_warmup_steps_) {
+    return;
+  }
+
+  const auto step_allocations = AllocationCounter::get() - allocations;
+  if (step_allocations != 0) {
+    AllocationCounter::Exclusion exclusion;
+    __logger_.log(Logger::Level::ERROR,
+                  to_string(step_allocations) + " allocations at step " +
+                      to_string(__step_number_));
+  }
+  assert(step_allocations == 0);
 }
 
 void ProtoLogicalProcessor::printProgression() const {
@@ -388,6 +974,52 @@ void ProtoLogicalProcessor::printProgression() const {
   std::cout.flush();
 }
 
+void ProtoLogicalProcessor::requestRetraction(
+    const RTI::EventRetractionHandle event_retraction_handle) noexcept {
+  __logger_ << __func__;
+  __up_time_management_policy_->retractionRequested(event_retraction_handle);
+}
+
+void ProtoLogicalProcessor::startRegistrationForObjectClass(
+    const RTI::ObjectClassHandle object_class_handle) noexcept {
+  __logger_ << __func__;
+  __logger_ << "Subscribers for class " + to_string(object_class_handle);
+}
+
+void ProtoLogicalProcessor::stopRegistrationForObjectClass(
+    const RTI::ObjectClassHandle object_class_handle) noexcept {
+  __logger_ << __func__;
+  __logger_ << "No more subscribers for class " +
+                   to_string(object_class_handle);
+  for (auto &up_published_object : __up_published_objects_) {
+    if (up_published_object->getObjectClassHandle() == object_class_handle) {
+      up_published_object->stopRegistration();
+    }
+  }
+}
+
+void ProtoLogicalProcessor::turnUpdatesOnForObjectInstance(
+    const RTI::ObjectHandle object_handle,
+    const RTI::AttributeHandleSet &attributes) noexcept {
+  __logger_ << __func__;
+  for (auto &up_published_object : __up_published_objects_) {
+    if (up_published_object->getHandle() == object_handle) {
+      up_published_object->turnUpdatesOn(attributes);
+    }
+  }
+}
+
+void ProtoLogicalProcessor::turnUpdatesOffForObjectInstance(
+    const RTI::ObjectHandle object_handle,
+    const RTI::AttributeHandleSet &attributes) noexcept {
+  __logger_ << __func__;
+  for (auto &up_published_object : __up_published_objects_) {
+    if (up_published_object->getHandle() == object_handle) {
+      up_published_object->turnUpdatesOff(attributes);
+    }
+  }
+}
+
 void ProtoLogicalProcessor::timeRegulationEnabled(
     const RTI::FedTime & /* time */) noexcept {
   __logger_ << __func__;
@@ -402,11 +1034,18 @@ void ProtoLogicalProcessor::timeConstrainedEnabled(
 
 void ProtoLogicalProcessor::timeAdvanceGrant(
     const RTI::FedTime &time) noexcept {
+  AllocationCounter::Inclusion inclusion;
   __logger_ << __func__;
   const auto fedtime = static_cast<RTIfedTime>(time);
-  __local_time_.set_us(static_cast<unsigned long long int>(fedtime.getTime()));
-  __logger_ << "TAG " + to_string(__local_time_.get_s());
+  __granted_time_.set_us(
+      static_cast<unsigned long long int>(fedtime.getTime()));
+  if (__logger_.isLogging()) {
+    __logger_ << "TAG " + to_string(__granted_time_.get_s());
+  }
   __has_time_advance_grant_ = true;
+  if (__up_io_thread_) {
+    __up_io_thread_->notifyGrant();
+  }
 }
 
 void ProtoLogicalProcessor::synchronizationPointRegistrationSucceeded(
@@ -466,6 +1105,90 @@ SeaplanesTime ProtoLogicalProcessor::getTimeStep() const {
   return (__time_step_);
 }
 
+SeaplanesTime ProtoLogicalProcessor::getLookahead() const {
+  return (__lookahead_);
+}
+
+SeaplanesTime ProtoLogicalProcessor::getSubStep() const {
+  return (SeaplanesTime(__time_step_.get_us() / __sub_steps_number_));
+}
+
+unsigned int ProtoLogicalProcessor::getSubStepIndex() const {
+  return (__sub_step_index_);
+}
+
+SeaplanesTime ProtoLogicalProcessor::getTimeLimit() const {
+  return (__time_limit_);
+}
+
+SeaplanesTime ProtoLogicalProcessor::getGrantedTime() const {
+  return (__granted_time_);
+}
+
+void ProtoLogicalProcessor::setLocalTime(SeaplanesTime time) {
+  __local_time_ = time;
+}
+
+void ProtoLogicalProcessor::setStepNumber(unsigned long long step_number) {
+  __step_number_ = step_number;
+}
+
+VecSpAttribute ProtoLogicalProcessor::getAttributes() const {
+  VecSpAttribute sp_attributes;
+  for (const auto &up_published_object : __up_published_objects_) {
+    const auto &sp_object_attributes = up_published_object->getAttributes();
+    sp_attributes.insert(sp_attributes.end(), sp_object_attributes.begin(),
+                         sp_object_attributes.end());
+  }
+  for (const auto &sp_subscribed_object : __sp_subscribed_objects_) {
+    const auto &sp_object_attributes = sp_subscribed_object->getAttributes();
+    sp_attributes.insert(sp_attributes.end(), sp_object_attributes.begin(),
+                         sp_object_attributes.end());
+  }
+  return (sp_attributes);
+}
+
+VecSpObjectClassStore ProtoLogicalProcessor::getStores() const {
+  VecSpObjectClassStore sp_stores;
+  const auto adding = [&sp_stores](const SpObjectClassStore &sp_store) {
+    if (sp_store &&
+        std::find(sp_stores.begin(), sp_stores.end(), sp_store) ==
+            sp_stores.end()) {
+      sp_stores.push_back(sp_store);
+    }
+  };
+  for (const auto &up_published_object : __up_published_objects_) {
+    adding(up_published_object->getStore());
+  }
+  for (const auto &sp_subscribed_object : __sp_subscribed_objects_) {
+    adding(sp_subscribed_object->getStore());
+  }
+  return (sp_stores);
+}
+
+const VecEventRetractionHandle &
+ProtoLogicalProcessor::getSentRetractionHandles() const {
+  return (__sent_retraction_handles_);
+}
+
+const Statistics &ProtoLogicalProcessor::getStatistics() const {
+  return (__statistics_);
+}
+
+void ProtoLogicalProcessor::saveState(SeaplanesTime /* time */) {}
+
+void ProtoLogicalProcessor::restoreState(SeaplanesTime /* time */) {}
+
+void ProtoLogicalProcessor::discardState(SeaplanesTime /* time */) {}
+
+double ProtoLogicalProcessor::getErrorEstimate() const {
+  auto error = 0.;
+  for (const auto &sp_model : __model_scheduler_.getModels()) {
+    error = std::max(error, sp_model->getErrorEstimate());
+  }
+  return (error);
+}
+
 bool ProtoLogicalProcessor::getAskTimeRegulator() const {
   return (__ask_time_regulator_);
 }
@@ -550,6 +1273,49 @@ unsigned long long ProtoLogicalProcessor::getStepNumber() const {
   return __step_number_;
 }
 
+void ProtoLogicalProcessor::setSimulationAffinity(CpuSet cpus) {
+  __placement_.setSimulationAffinity(move(cpus));
+}
+
+void ProtoLogicalProcessor::setRtiaAffinity(CpuSet cpus) {
+  __placement_.setRtiaAffinity(move(cpus));
+}
+
+void ProtoLogicalProcessor::setStallThreshold(double threshold) {
+  __up_watchdog_.reset();
+  if (threshold > 0.) {
+    __up_watchdog_ = Watchdog::create(__federate_name_, threshold);
+  }
+}
+
+void ProtoLogicalProcessor::setAllocationWarmupSteps(
+    unsigned long long steps) {
+  __allocation_warmup_steps_ = steps;
+}
+
+void ProtoLogicalProcessor::enableRelevanceAdvisories() {
+  __relevance_advisories_ = true;
+}
+
+void ProtoLogicalProcessor::enableStatisticsPublication(Name class_name) {
+  auto sp_object = Object::create(move(class_name));
+  auto up_instance = ObjectInstancePublished::create(
+      __federate_name_ + "Statistics", sp_object);
+
+  __sp_statistics_attributes_ = {
+      Attribute::create("lastBlockedTime"),
+      Attribute::create("lastComputeTime"),
+      Attribute::create("totalBlockedTime"),
+      Attribute::create("totalComputeTime")};
+  for (const auto &sp_attribute : __sp_statistics_attributes_) {
+    sp_attribute->setValue(0.);
+    bindAttribute(up_instance, sp_attribute);
+  }
+
+  addObjectClass(sp_object);
+  addPublishedObject(move(up_instance));
+}
+
 void ProtoLogicalProcessor::enableTimeRegulation() {
   __rti_amb_.enableTimeRegulation(
       static_cast<RTIfedTime>(__local_time_.get_us()),
@@ -589,29 +1355,91 @@ void ProtoLogicalProcessor::timeAdvanceRequest(const SeaplanesTime dt) {
   const auto requested_time = __local_time_ + dt;
   const auto tar = static_cast<RTIfedTime>(requested_time.get_us());
 
-  __logger_ << "TAR " + to_string(requested_time.get_s());
+  if (__logger_.isLogging()) {
+    __logger_ << "TAR " + to_string(requested_time.get_s());
+  }
 
-  __rti_amb_.timeAdvanceRequest(tar);
+  blockingStart(requested_time);
+  {
+    AllocationCounter::Exclusion exclusion;
+    if (__up_io_thread_) {
+      {
+        IoThread::Lock lock(__up_io_thread_.get());
+        __rti_amb_.timeAdvanceRequest(tar);
+      }
+      __up_io_thread_->waitGrant();
+    } else {
+      __rti_amb_.timeAdvanceRequest(tar);
 
-  while (!__has_time_advance_grant_) {
-    __rti_amb_.tick2();
-    sched_yield();
+      while (!__has_time_advance_grant_) {
+        __rti_amb_.tick2();
+        sched_yield();
+      }
+    }
   }
 
+  blockingStop();
+
+  __local_time_ = __granted_time_;
   __has_time_advance_grant_ = false;
 }
 
+void ProtoLogicalProcessor::blockingStart(const SeaplanesTime requested_time) {
+  __statistics_.startBlocking();
+  if (__up_watchdog_) {
+    __up_watchdog_->arm(requested_time, __granted_time_, __step_number_);
+  }
+}
+
+void ProtoLogicalProcessor::blockingStop() {
+  if (__up_watchdog_) {
+    __up_watchdog_->disarm();
+  }
+  __statistics_.stopBlocking();
+}
+
+void ProtoLogicalProcessor::flushQueueRequest(const SeaplanesTime time) {
+  __logger_ << "FQR " + to_string(time.get_s());
+  __rti_amb_.flushQueueRequest(static_cast<RTIfedTime>(time.get_us()));
+}
+
+void ProtoLogicalProcessor::tick() {
+  AllocationCounter::Exclusion exclusion;
+  __rti_amb_.tick();
+}
+
+void ProtoLogicalProcessor::tick2() {
+  AllocationCounter::Exclusion exclusion;
+  __rti_amb_.tick2();
+}
+
+void ProtoLogicalProcessor::retract(
+    const RTI::EventRetractionHandle event_retraction_handle) {
+  try {
+    __rti_amb_.retract(event_retraction_handle);
+  } catch (const RTI::Exception &e) {
+    __logger_.log(Logger::Level::WARN, "Retraction failed " + string(e._name) +
+                                           "( " + string(e._reason) + " ).");
+  }
+}
+
 void ProtoLogicalProcessor::discoverObjectInstance(
     RTI::ObjectHandle object_handle, RTI::ObjectClassHandle object_class_handle,
     const char name[]) noexcept {
   __logger_ << __func__;
   __logger_ << "Discovering object " + string(name);
 
-  for (auto &sp_subscribed_object : __sp_subscribed_objects_) {
+  // Only the undiscovered instances of the same name may match.
+  const auto range = __map_undiscovered_objects_.equal_range(name);
+  for (auto it = range.first; it != range.second; ++it) {
+    auto &sp_subscribed_object = it->second;
     sp_subscribed_object->tryToDiscover(name, object_class_handle,
                                         object_handle);
-    __map_sp_subscribed_objects_[sp_subscribed_object->getHandle()] =
-        sp_subscribed_object;
+    if (sp_subscribed_object->getDiscovered()) {
+      __map_sp_subscribed_objects_[object_handle] = sp_subscribed_object;
+      __map_undiscovered_objects_.erase(it);
+      break;
+    }
   }
 }
 
@@ -619,10 +1447,44 @@ void ProtoLogicalProcessor::reflectAttributeValues(
     const RTI::ObjectHandle handle,
     const RTI::AttributeHandleValuePairSet &values,
     const char /* tag */[]) noexcept {
-  try {
-    auto sp_subscribed_object = __map_sp_subscribed_objects_.at(handle);
-    sp_subscribed_object->reflectAttributeValues(values);
-  } catch (const std::out_of_range &) {
+  AllocationCounter::Inclusion inclusion;
+  receptionCounting(values);
+  // Received in order, at the time of the last grant.
+  reflection(handle, values, __granted_time_, false);
+}
+
+void ProtoLogicalProcessor::receptionCounting(
+    const RTI::AttributeHandleValuePairSet &values) {
+  if (!__up_metrics_) {
+    return;
+  }
+  auto bytes = 0UL;
+  for (auto i = 0U; i < values.size(); ++i) {
+    bytes += values.getValueLength(i);
+  }
+  __up_metrics_->countReceived(values.size(), bytes);
+}
+
+void ProtoLogicalProcessor::receptionCounting(
+    const RTI::ParameterHandleValuePairSet &parameters) {
+  if (!__up_metrics_) {
+    return;
+  }
+  auto bytes = 0UL;
+  for (auto i = 0U; i < parameters.size(); ++i) {
+    bytes += parameters.getValueLength(i);
+  }
+  __up_metrics_->countReceived(parameters.size(), bytes);
+}
+
+void ProtoLogicalProcessor::reflection(
+    const RTI::ObjectHandle handle,
+    const RTI::AttributeHandleValuePairSet &values, SeaplanesTime time,
+    bool time_stamped) {
+  const auto it = __map_sp_subscribed_objects_.find(handle);
+  if (it != __map_sp_subscribed_objects_.end()) {
+    it->second->reflectAttributeValues(values, time, time_stamped);
+  } else {
     // Due to reception of attribute with same name, but for different
     // instances, we need to check if the given attribute received is the one
     // awaited. If not, it won't be in the map. Nothing to do, but if you want
@@ -635,16 +1497,84 @@ void ProtoLogicalProcessor::reflectAttributeValues(
     const RTI::ObjectHandle handle,
     const RTI::AttributeHandleValuePairSet &values, const RTI::FedTime &time,
     const char tag[],
-    const RTI::EventRetractionHandle /* event_reaction_handle */) noexcept {
+    const RTI::EventRetractionHandle event_retraction_handle) noexcept {
+  AllocationCounter::Inclusion inclusion;
+  receptionCounting(values);
   auto fedtime = static_cast<RTIfedTime>(time);
 
-  __up_rav_tags_.emplace_back(new Tag(tag));
+  // With an I/O thread, the logs would race with the simulation thread.
+  const auto logging = !__up_io_thread_ && __logger_.isLogging();
 
-  reflectAttributeValues(handle, values, tag);
+  if (logging) {
+    // Tags storage is reused, only growing during the first steps.
+    if (__rav_tags_number_ == __rav_tags_.size()) {
+      __rav_tags_.emplace_back(tag);
+    } else {
+      __rav_tags_[__rav_tags_number_].assign(tag);
+    }
+    ++__rav_tags_number_;
+  }
 
-  __logger_ << "postRAV\t" + Tag(tag) + "\t(" +
-                   to_string(__local_time_.get_s()) + ",\t" +
-                   to_string(fedtime.getTime() * SeaplanesTime::us2s) + ")";
+  const auto reflection_time =
+      SeaplanesTime(static_cast<unsigned long long>(fedtime.getTime()));
+  if (!__up_time_management_policy_->reflectionReceived(
+          handle, values, reflection_time, event_retraction_handle)) {
+    reflection(handle, values, reflection_time);
+  }
+
+  if (logging) {
+    __logger_ << "postRAV\t" + Tag(tag) + "\t(" +
+                     to_string(__local_time_.get_s()) + ",\t" +
+                     to_string(fedtime.getTime() * SeaplanesTime::us2s) + ")";
+  }
+}
+
+void ProtoLogicalProcessor::receiveInteraction(
+    const RTI::InteractionClassHandle handle,
+    const RTI::ParameterHandleValuePairSet &parameters,
+    const char /* tag */[]) noexcept {
+  AllocationCounter::Inclusion inclusion;
+  receptionCounting(parameters);
+  // Received in order, at the time of the last grant.
+  interactionReception(handle, parameters, __granted_time_);
+}
+
+void ProtoLogicalProcessor::receiveInteraction(
+    const RTI::InteractionClassHandle handle,
+    const RTI::ParameterHandleValuePairSet &parameters,
+    const RTI::FedTime &time, const char /* tag */[],
+    const RTI::EventRetractionHandle /* event_retraction_handle */) noexcept {
+  AllocationCounter::Inclusion inclusion;
+  receptionCounting(parameters);
+  // Only granted interactions are delivered, the optimistic policy being
+  // refused with subscribed interactions: they are never retracted.
+  const auto fedtime = static_cast<RTIfedTime>(time);
+  interactionReception(
+      handle, parameters,
+      SeaplanesTime(static_cast<unsigned long long>(fedtime.getTime())));
+}
+
+void ProtoLogicalProcessor::interactionReception(
+    const RTI::InteractionClassHandle handle,
+    const RTI::ParameterHandleValuePairSet &parameters, SeaplanesTime time) {
+  const auto it = __map_sp_subscribed_interactions_.find(handle);
+  if (it == __map_sp_subscribed_interactions_.end()) {
+    __logger_.log(Logger::Level::ERROR, "Unknown interaction class");
+    return;
+  }
+
+  // Queue storage is reused, only growing during the first steps.
+  if (__incoming_interactions_number_ == __incoming_interactions_.size()) {
+    __incoming_interactions_.emplace_back(it->second);
+  } else if (__incoming_interactions_[__incoming_interactions_number_]
+                 .getInteractionClass() != it->second) {
+    __incoming_interactions_[__incoming_interactions_number_]
+        .setInteractionClass(it->second);
+  }
+  auto &interaction = __incoming_interactions_[__incoming_interactions_number_];
+  interaction.decodeParameters(parameters);
+  interaction.setTime(time);
+  ++__incoming_interactions_number_;
 }
 
 } // namespace Seaplanes
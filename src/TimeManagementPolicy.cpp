@@ -41,4 +41,14 @@ auto TimeManagementPolicy::setDt(SeaplanesTime dt) -> void { __dt_ = dt; }
 
 auto TimeManagementPolicy::getLP() -> ProtoLogicalProcessor & { return __lp_; }
 
+auto TimeManagementPolicy::reflectionReceived(
+    RTI::ObjectHandle /* object_handle */,
+    const RTI::AttributeHandleValuePairSet & /* values */,
+    SeaplanesTime /* time */, RTI::EventRetractionHandle /* handle */) -> bool {
+  return false;
+}
+
+auto TimeManagementPolicy::retractionRequested(
+    RTI::EventRetractionHandle /* handle */) -> void {}
+
 } // namespace Seaplanes
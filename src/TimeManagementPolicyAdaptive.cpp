@@ -0,0 +1,187 @@
+//! \file    TimeManagementPolicyAdaptive.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Adaptive timestep time management specialization implementation.
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include <LogicalProcessorLogger.h>
+#include <ProtoLogicalProcessor.h>
+#include <TimeManagementPolicyAdaptive.h>
+
+using std::to_string;
+
+namespace Seaplanes {
+
+namespace {
+
+//! Margin on the step predicted to reach the tolerance.
+constexpr auto safety_factor = 0.9;
+
+//! Largest growth of the step, from a step to the next.
+constexpr auto max_growth_factor = 2.;
+
+//! Largest shrink of the step, from a step to the next.
+constexpr auto min_growth_factor = 0.2;
+
+constexpr auto s2us = 1e6;
+
+} // namespace
+
+TimeManagementPolicyAdaptive::TimeManagementPolicyAdaptive(
+    ProtoLogicalProcessor &lp)
+    : __up_time_management_policy_(std::make_unique<TimeManagementPolicy>(lp)),
+      __min_step_(lp.getTimeStep()), __max_step_(lp.getTimeStep()),
+      __step_(lp.getTimeStep()), __tolerance_(1.), __order_(1), __steps_(0),
+      __over_tolerance_steps_(0), __shortest_step_(0_s),
+      __longest_step_(0_s) {}
+
+void TimeManagementPolicyAdaptive::initializing() {
+  __up_time_management_policy_->initializing();
+  __step_ = boundedStep(__step_.get_s());
+}
+
+void TimeManagementPolicyAdaptive::timeAdvance() {
+  auto &lp = getLP();
+
+  // The error of the step just computed, before the reflections of the next.
+  const auto error = lp.getErrorEstimate();
+
+  if (__steps_ == 0 || __step_ < __shortest_step_) {
+    __shortest_step_ = __step_;
+  }
+  if (__steps_ == 0 || __step_ > __longest_step_) {
+    __longest_step_ = __step_;
+  }
+  ++__steps_;
+
+  setDt(__step_);
+  __up_time_management_policy_->timeAdvance();
+  nextStep(error);
+}
+
+void TimeManagementPolicyAdaptive::deactivating() {
+  Logger::get_instance().log(
+      Logger::Level::NOTICE,
+      "Adaptive steps " + to_string(__steps_) + ", over tolerance " +
+          to_string(__over_tolerance_steps_) + ", shortest " +
+          to_string(__shortest_step_.get_s()) + "s, longest " +
+          to_string(__longest_step_.get_s()) + "s");
+  __up_time_management_policy_->deactivating();
+}
+
+auto TimeManagementPolicyAdaptive::setDt(SeaplanesTime dt) -> void {
+  __up_time_management_policy_->setDt(dt);
+}
+
+auto TimeManagementPolicyAdaptive::getLP() -> ProtoLogicalProcessor & {
+  return __up_time_management_policy_->getLP();
+}
+
+auto TimeManagementPolicyAdaptive::reflectionReceived(
+    RTI::ObjectHandle object_handle,
+    const RTI::AttributeHandleValuePairSet &values, SeaplanesTime time,
+    RTI::EventRetractionHandle handle) -> bool {
+  return __up_time_management_policy_->reflectionReceived(object_handle, values,
+                                                          time, handle);
+}
+
+auto TimeManagementPolicyAdaptive::retractionRequested(
+    RTI::EventRetractionHandle handle) -> void {
+  __up_time_management_policy_->retractionRequested(handle);
+}
+
+void TimeManagementPolicyAdaptive::setStepBounds(SeaplanesTime min_step,
+                                                 SeaplanesTime max_step) {
+  if (min_step.get_us() == 0 || max_step < min_step ||
+      max_step < getLP().getLookahead()) {
+    throw std::invalid_argument("Adaptive step bounds [" +
+                                to_string(min_step.get_s()) + "s, " +
+                                to_string(max_step.get_s()) + "s]");
+  }
+  __min_step_ = min_step;
+  __max_step_ = max_step;
+  __step_ = boundedStep(__step_.get_s());
+}
+
+void TimeManagementPolicyAdaptive::setTolerance(double tolerance) {
+  if (!(tolerance > 0.)) {
+    throw std::invalid_argument("Adaptive step tolerance " +
+                                to_string(tolerance));
+  }
+  __tolerance_ = tolerance;
+}
+
+void TimeManagementPolicyAdaptive::setOrder(unsigned int order) {
+  __order_ = order;
+}
+
+SeaplanesTime TimeManagementPolicyAdaptive::getStep() const {
+  return (__step_);
+}
+
+unsigned long long
+TimeManagementPolicyAdaptive::getOverToleranceStepsNumber() const {
+  return (__over_tolerance_steps_);
+}
+
+void TimeManagementPolicyAdaptive::nextStep(double error) {
+  if (error > __tolerance_) {
+    ++__over_tolerance_steps_;
+  }
+  const auto factor = growthFactor(error, __tolerance_, __order_);
+  __step_ = boundedStep(__step_.get_s() * factor);
+}
+
+SeaplanesTime TimeManagementPolicyAdaptive::boundedStep(double step) {
+  auto &lp = getLP();
+  return (boundStep(step, __min_step_, __max_step_, lp.getLookahead(),
+                    lp.getLocalTime(), lp.getTimeLimit()));
+}
+
+double TimeManagementPolicyAdaptive::growthFactor(double error,
+                                                  double tolerance,
+                                                  unsigned int order) {
+  // Without error, the step grows as much as allowed.
+  if (!(error > 0.)) {
+    return (max_growth_factor);
+  }
+  const auto factor =
+      safety_factor *
+      std::pow(tolerance / error, 1. / static_cast<double>(order + 1));
+  return (std::max(min_growth_factor, std::min(max_growth_factor, factor)));
+}
+
+SeaplanesTime TimeManagementPolicyAdaptive::boundStep(
+    double step, SeaplanesTime min_step, SeaplanesTime max_step,
+    SeaplanesTime lookahead, SeaplanesTime local_time,
+    SeaplanesTime time_limit) {
+  const auto min_us = min_step.get_us();
+  const auto max_us = max_step.get_us();
+
+  // Not shorter than the lookahead, so that the updates of a step, stamped
+  // with the local time plus the lookahead, are reflected at the next one.
+  auto shortest_us = std::max(min_us, lookahead.get_us());
+  if (min_us > 0 && shortest_us % min_us != 0) {
+    shortest_us += min_us - shortest_us % min_us;
+  }
+
+  auto step_us = static_cast<unsigned long long>(
+      std::max(0., std::round(step * s2us)));
+  step_us = std::max(shortest_us, std::min(max_us, step_us));
+  if (min_us > 0) {
+    // On the grid of the shortest step.
+    step_us -= step_us % min_us;
+  }
+
+  if (local_time < time_limit) {
+    step_us = std::min(step_us, time_limit.get_us() - local_time.get_us());
+  }
+  return (SeaplanesTime(step_us));
+}
+
+} // namespace Seaplanes
@@ -6,7 +6,10 @@
 
 #include <memory>
 
+#include <TimeManagementPolicyAdaptive.h>
 #include <TimeManagementPolicyFactory.h>
+#include <TimeManagementPolicyOptimistic.h>
+#include <TimeManagementPolicyRealTime.h>
 #include <TimeManagementPolicyTimeStep.h>
 
 using std::make_unique;
@@ -21,4 +24,26 @@ TimeManagementPolicyFactory::create<TimeManagementPolicyTimeStep>(
   return make_unique<TimeManagementPolicyTimeStep>(federate);
 }
 
+template <>
+UpITimeManagementPolicy
+TimeManagementPolicyFactory::create<TimeManagementPolicyRealTime>(
+    class ProtoLogicalProcessor &federate) {
+  return make_unique<TimeManagementPolicyRealTime>(federate);
+}
+
+
+template <>
+UpITimeManagementPolicy
+TimeManagementPolicyFactory::create<TimeManagementPolicyOptimistic>(
+    class ProtoLogicalProcessor &federate) {
+  return make_unique<TimeManagementPolicyOptimistic>(federate);
+}
+
+template <>
+UpITimeManagementPolicy
+TimeManagementPolicyFactory::create<TimeManagementPolicyAdaptive>(
+    class ProtoLogicalProcessor &federate) {
+  return make_unique<TimeManagementPolicyAdaptive>(federate);
+}
+
 } // namespace Seaplanes
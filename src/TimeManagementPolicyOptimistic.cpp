@@ -0,0 +1,293 @@
+//! \file    TimeManagementPolicyOptimistic.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Optimistic (Time Warp) time management specialization
+//! implementation.
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <LogicalProcessorLogger.h>
+#include <ProtoLogicalProcessor.h>
+#include <TimeManagementPolicyOptimistic.h>
+
+using std::move;
+using std::string;
+using std::to_string;
+using std::vector;
+
+namespace Seaplanes {
+
+TimeManagementPolicyOptimistic::TimeManagementPolicyOptimistic(
+    ProtoLogicalProcessor &lp)
+    : __up_time_management_policy_(std::make_unique<TimeManagementPolicy>(lp)),
+      __dt_(0_s), __window_(8), __flush_pending_(false),
+      __rollback_pending_(false), __rollback_to_(0_s),
+      __state_saver_(StateSaver()), __inputs_(std::deque<Input>()),
+      __rollbacks_(0), __rolled_back_steps_(0) {}
+
+void TimeManagementPolicyOptimistic::initializing() {
+  if (getLP().__io_thread_enabled_) {
+    throw std::logic_error("Optimistic policy ticking the RTI, without I/O "
+                           "thread");
+  }
+  __up_time_management_policy_->initializing();
+  __state_saver_.track(getLP().getAttributes());
+  __state_saver_.trackStores(getLP().getStores());
+  vector<ObjectInstanceSubscribed *> p_subscribed_objects;
+  for (const auto &sp_subscribed_object : getLP().__sp_subscribed_objects_) {
+    p_subscribed_objects.push_back(sp_subscribed_object.get());
+  }
+  __state_saver_.trackExtrapolators(move(p_subscribed_objects));
+  vector<ObjectInstancePublished *> p_published_objects;
+  for (const auto &up_published_object : getLP().__up_published_objects_) {
+    p_published_objects.push_back(up_published_object.get());
+  }
+  __state_saver_.trackUpdatePolicies(move(p_published_objects));
+  checkpoint();
+}
+
+void TimeManagementPolicyOptimistic::timeAdvance() {
+  auto &lp = getLP();
+
+  __state_saver_.recordSent(lp.getSentRetractionHandles());
+
+  setDt(lp.getTimeStep());
+  lp.setLocalTime(lp.getLocalTime() + __dt_);
+  checkpoint();
+  reflectInputs();
+
+  synchronize(!(lp.getLocalTime() < lp.getTimeLimit()));
+}
+
+void TimeManagementPolicyOptimistic::deactivating() {
+  Logger::get_instance().log(
+      Logger::Level::NOTICE,
+      "Optimistic rollbacks " + to_string(__rollbacks_) + ", steps undone " +
+          to_string(__rolled_back_steps_));
+  __up_time_management_policy_->deactivating();
+}
+
+auto TimeManagementPolicyOptimistic::setDt(SeaplanesTime dt) -> void {
+  __dt_ = dt;
+}
+
+auto TimeManagementPolicyOptimistic::getLP() -> ProtoLogicalProcessor & {
+  return __up_time_management_policy_->getLP();
+}
+
+auto TimeManagementPolicyOptimistic::reflectionReceived(
+    RTI::ObjectHandle object_handle,
+    const RTI::AttributeHandleValuePairSet &values, SeaplanesTime time,
+    RTI::EventRetractionHandle handle) -> bool {
+  auto &lp = getLP();
+
+  UpRTIAttributeHandleValuePairSet up_values(
+      RTI::AttributeSetFactory::create(values.size()));
+  vector<char> buffer;
+  for (auto i = 0U; i < values.size(); ++i) {
+    auto length = values.getValueLength(i);
+    buffer.resize(length);
+    values.getValue(i, buffer.data(), length);
+    up_values->add(values.getHandle(i), buffer.data(), length);
+  }
+  __inputs_.push_back(
+      Input{time, object_handle, move(up_values), handle, false, 0_s});
+
+  // The step consuming the input is the first step at or after its time
+  // stamp. If it is already computed, the input is a straggler.
+  auto consuming_time = lp.getLocalTime();
+  if (__state_saver_.findCheckpoint(time, consuming_time) &&
+      consuming_time < lp.getLocalTime()) {
+    requestRollback(time);
+  } else if (time <= lp.getLocalTime()) {
+    auto &input = __inputs_.back();
+    lp.reflection(input.object_handle, *input.up_values, input.time);
+    input.reflected = true;
+    input.reflected_time = lp.getLocalTime();
+  }
+
+  return true;
+}
+
+auto TimeManagementPolicyOptimistic::retractionRequested(
+    RTI::EventRetractionHandle handle) -> void {
+  const auto it =
+      std::find_if(__inputs_.begin(), __inputs_.end(), [&](const Input &input) {
+        return sameHandle(input.handle, handle);
+      });
+  if (it == __inputs_.end()) {
+    return;
+  }
+  if (it->reflected) {
+    requestRollback(it->reflected_time);
+  }
+  __inputs_.erase(it);
+}
+
+void TimeManagementPolicyOptimistic::setWindow(unsigned int steps) {
+  __window_ = steps;
+}
+
+unsigned long long TimeManagementPolicyOptimistic::getRollbacksNumber() const {
+  return (__rollbacks_);
+}
+
+unsigned long long
+TimeManagementPolicyOptimistic::getRolledBackStepsNumber() const {
+  return (__rolled_back_steps_);
+}
+
+void TimeManagementPolicyOptimistic::checkpoint() {
+  auto &lp = getLP();
+  __state_saver_.checkpoint(lp.getLocalTime(), lp.getStepNumber());
+  lp.saveState(lp.getLocalTime());
+}
+
+void TimeManagementPolicyOptimistic::reflectInputs() {
+  auto &lp = getLP();
+  const auto local_time = lp.getLocalTime();
+
+  vector<Input *> p_inputs;
+  for (auto &input : __inputs_) {
+    if (!input.reflected && input.time <= local_time) {
+      p_inputs.push_back(&input);
+    }
+  }
+  std::stable_sort(p_inputs.begin(), p_inputs.end(),
+                   [](const Input *p_lhs, const Input *p_rhs) {
+                     return p_lhs->time < p_rhs->time;
+                   });
+
+  for (auto *p_input : p_inputs) {
+    lp.reflection(p_input->object_handle, *p_input->up_values, p_input->time);
+    p_input->reflected = true;
+    p_input->reflected_time = local_time;
+  }
+}
+
+void TimeManagementPolicyOptimistic::requestRollback(SeaplanesTime time) {
+  auto rollback_time = time;
+  if (!__state_saver_.findCheckpoint(time, rollback_time)) {
+    Logger::get_instance().log(Logger::Level::ERROR,
+                               "No checkpoint to roll back to " +
+                                   to_string(time.get_s()) + "s.");
+    return;
+  }
+  if (!__rollback_pending_ || rollback_time < __rollback_to_) {
+    __rollback_to_ = rollback_time;
+  }
+  __rollback_pending_ = true;
+}
+
+void TimeManagementPolicyOptimistic::rollback() {
+  auto &lp = getLP();
+  const auto local_time = lp.getLocalTime();
+  auto step_number = lp.getStepNumber();
+  VecEventRetractionHandle sent;
+
+  __state_saver_.rollback(__rollback_to_, step_number, sent);
+  for (const auto &handle : sent) {
+    lp.retract(handle);
+  }
+
+  for (auto &input : __inputs_) {
+    if (input.reflected && input.reflected_time >= __rollback_to_) {
+      input.reflected = false;
+    }
+  }
+
+  lp.setLocalTime(__rollback_to_);
+  lp.setStepNumber(step_number);
+  lp.reflectionsDiscarding();
+  lp.restoreState(__rollback_to_);
+
+  ++__rollbacks_;
+  if (__dt_.get_us() != 0) {
+    __rolled_back_steps_ +=
+        (local_time.get_us() - __rollback_to_.get_us()) / __dt_.get_us();
+  }
+  Logger::get_instance() << "Rollback from " + to_string(local_time.get_s()) +
+                                "s to " + to_string(__rollback_to_.get_s()) +
+                                "s, " + to_string(sent.size()) +
+                                " updates retracted";
+
+  __rollback_pending_ = false;
+  reflectInputs();
+}
+
+void TimeManagementPolicyOptimistic::synchronize(bool commit) {
+  auto &lp = getLP();
+  const auto window_us = __window_ * __dt_.get_us();
+  auto blocked = false;
+
+  while (true) {
+    lp.tick();
+
+    if (lp.getTimeAdvanceGrant()) {
+      lp.setTimeAdvanceNotGrant();
+      __flush_pending_ = false;
+      fossilCollect();
+    }
+
+    if (__rollback_pending_) {
+      rollback();
+      // Steps to compute again, no commit until they are.
+      commit = !(lp.getLocalTime() < lp.getTimeLimit());
+    }
+
+    const auto local_time = lp.getLocalTime();
+    const auto granted_time = lp.getGrantedTime();
+
+    if (!__flush_pending_ && granted_time < local_time) {
+      lp.flushQueueRequest(local_time);
+      __flush_pending_ = true;
+    }
+
+    const auto ahead_us = (granted_time < local_time)
+                              ? local_time.get_us() - granted_time.get_us()
+                              : 0ULL;
+    if (commit ? ahead_us == 0 : ahead_us <= window_us) {
+      break;
+    }
+
+    if (!blocked) {
+      lp.blockingStart(local_time);
+      blocked = true;
+    }
+    lp.tick2();
+  }
+
+  if (blocked) {
+    lp.blockingStop();
+  }
+}
+
+void TimeManagementPolicyOptimistic::fossilCollect() {
+  auto &lp = getLP();
+  const auto granted_time = lp.getGrantedTime();
+
+  __state_saver_.fossilCollect(granted_time);
+  lp.discardState(granted_time);
+
+  auto oldest_time = granted_time;
+  __state_saver_.findCheckpoint(0_s, oldest_time);
+  __inputs_.erase(std::remove_if(__inputs_.begin(), __inputs_.end(),
+                                 [&](const Input &input) {
+                                   return input.reflected &&
+                                          input.reflected_time < oldest_time;
+                                 }),
+                  __inputs_.end());
+}
+
+bool TimeManagementPolicyOptimistic::sameHandle(
+    const RTI::EventRetractionHandle &lhs,
+    const RTI::EventRetractionHandle &rhs) {
+  return (lhs.theSerialNumber == rhs.theSerialNumber &&
+          lhs.sendingFederate == rhs.sendingFederate);
+}
+
+} // namespace Seaplanes
@@ -0,0 +1,252 @@
+//! \file    TimeManagementPolicyRealTime.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Real-time paced time management specialization implementation.
+
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+
+#include <LogicalProcessorLogger.h>
+#include <ProtoLogicalProcessor.h>
+#include <TimeManagementPolicyRealTime.h>
+
+using std::string;
+using std::to_string;
+
+namespace Seaplanes {
+
+namespace {
+
+//! Size of the stack area touched when prefaulting.
+constexpr auto prefault_stack_size = 512U * 1024U;
+
+constexpr auto s2ns = 1000000000LL;
+constexpr auto us2ns = 1000LL;
+
+long long toNs(const struct timespec &ts) {
+  return (static_cast<long long>(ts.tv_sec) * s2ns + ts.tv_nsec);
+}
+
+struct timespec fromNs(long long ns) {
+  struct timespec ts {};
+  ts.tv_sec = static_cast<time_t>(ns / s2ns);
+  ts.tv_nsec = static_cast<long>(ns % s2ns);
+  return (ts);
+}
+
+long long nowNs() {
+  struct timespec ts {};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (toNs(ts));
+}
+
+//! \brief Touch the stack so that its pages are mapped before the loop.
+void prefaultStack() {
+  unsigned char stack[prefault_stack_size];
+  volatile unsigned char *const p_stack = stack;
+  for (auto i = 0U; i < prefault_stack_size; i += 4096U) {
+    p_stack[i] = 0;
+  }
+}
+
+//! \brief Sleep until the given absolute monotonic time.
+void sleepUntil(long long deadline_ns) {
+#ifdef TIMER_ABSTIME
+  const auto deadline = fromNs(deadline_ns);
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr) ==
+         EINTR) {
+  }
+#else  // TIMER_ABSTIME
+  // No absolute sleep available (i.e. macOS), relative sleep fallback.
+  auto remaining = fromNs(deadline_ns - nowNs());
+  while (nanosleep(&remaining, &remaining) == -1 && errno == EINTR) {
+  }
+#endif // TIMER_ABSTIME
+}
+
+} // namespace
+
+void RealTimeStatistics::record(long long lateness_ns, bool overrun) {
+  if (steps == 0 || lateness_ns > max_lateness_ns) {
+    max_lateness_ns = lateness_ns;
+  }
+  if (steps == 0 || lateness_ns < min_lateness_ns) {
+    min_lateness_ns = lateness_ns;
+  }
+  ++steps;
+  if (overrun) {
+    ++overruns;
+  }
+  sum_lateness_ns += static_cast<double>(lateness_ns);
+  sum_sq_lateness_ns +=
+      static_cast<double>(lateness_ns) * static_cast<double>(lateness_ns);
+
+  auto bucket = 0U;
+  for (auto lateness_us = lateness_ns / us2ns;
+       lateness_us > 0 && bucket < histogram_size - 1; lateness_us >>= 1) {
+    ++bucket;
+  }
+  ++histogram[bucket];
+}
+
+double RealTimeStatistics::getMeanLatenessNs() const {
+  return (steps == 0 ? 0. : sum_lateness_ns / static_cast<double>(steps));
+}
+
+double RealTimeStatistics::getJitterNs() const {
+  if (steps == 0) {
+    return (0.);
+  }
+  const auto mean = getMeanLatenessNs();
+  const auto variance =
+      sum_sq_lateness_ns / static_cast<double>(steps) - mean * mean;
+  return (variance > 0. ? std::sqrt(variance) : 0.);
+}
+
+TimeManagementPolicyRealTime::TimeManagementPolicyRealTime(
+    ProtoLogicalProcessor &lp)
+    : __up_time_management_policy_(std::make_unique<TimeManagementPolicy>(lp)),
+      __real_time_factor_(1.), __lock_memory_(false),
+      __scheduling_priority_(0), __anchored_(false), __wall_origin_(),
+      __logical_origin_(0_s), __statistics_() {}
+
+void TimeManagementPolicyRealTime::initializing() {
+  applyRealTimeSettings();
+  __up_time_management_policy_->initializing();
+}
+
+void TimeManagementPolicyRealTime::timeAdvance() {
+  if (!__anchored_) {
+    clock_gettime(CLOCK_MONOTONIC, &__wall_origin_);
+    __logical_origin_ = getLP().getLocalTime();
+    __anchored_ = true;
+  }
+  setDt(getLP().getTimeStep());
+  __up_time_management_policy_->timeAdvance();
+  waitDeadline();
+}
+
+void TimeManagementPolicyRealTime::deactivating() {
+  logStatistics();
+  __up_time_management_policy_->deactivating();
+}
+
+auto TimeManagementPolicyRealTime::setDt(SeaplanesTime dt) -> void {
+  __up_time_management_policy_->setDt(dt);
+}
+
+auto TimeManagementPolicyRealTime::getLP() -> ProtoLogicalProcessor & {
+  return __up_time_management_policy_->getLP();
+}
+
+auto TimeManagementPolicyRealTime::reflectionReceived(
+    RTI::ObjectHandle object_handle,
+    const RTI::AttributeHandleValuePairSet &values, SeaplanesTime time,
+    RTI::EventRetractionHandle handle) -> bool {
+  return __up_time_management_policy_->reflectionReceived(object_handle, values,
+                                                          time, handle);
+}
+
+auto TimeManagementPolicyRealTime::retractionRequested(
+    RTI::EventRetractionHandle handle) -> void {
+  __up_time_management_policy_->retractionRequested(handle);
+}
+
+void TimeManagementPolicyRealTime::setRealTimeFactor(double factor) {
+  if (!(factor > 0.)) {
+    throw std::invalid_argument("Real-time factor " + to_string(factor));
+  }
+  __real_time_factor_ = factor;
+}
+
+double TimeManagementPolicyRealTime::getRealTimeFactor() const {
+  return (__real_time_factor_);
+}
+
+void TimeManagementPolicyRealTime::setLockMemory(bool lock_memory) {
+  __lock_memory_ = lock_memory;
+}
+
+void TimeManagementPolicyRealTime::setSchedulingPriority(int priority) {
+  __scheduling_priority_ = priority;
+}
+
+const RealTimeStatistics &TimeManagementPolicyRealTime::getStatistics() const {
+  return (__statistics_);
+}
+
+void TimeManagementPolicyRealTime::applyRealTimeSettings() {
+  auto &logger = Logger::get_instance();
+
+  if (__lock_memory_) {
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+      logger.log(Logger::Level::WARN,
+                 "mlockall failed: " + string(std::strerror(errno)));
+    }
+    prefaultStack();
+  }
+
+  if (__scheduling_priority_ > 0) {
+    struct sched_param param {};
+    param.sched_priority = __scheduling_priority_;
+    const auto error =
+        pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (error != 0) {
+      logger.log(Logger::Level::WARN,
+                 "SCHED_FIFO not applied: " + string(std::strerror(error)));
+    }
+  }
+}
+
+void TimeManagementPolicyRealTime::waitDeadline() {
+  const auto logical_elapsed_us =
+      getLP().getLocalTime().get_us() - __logical_origin_.get_us();
+  const auto deadline_ns =
+      toNs(__wall_origin_) +
+      static_cast<long long>(static_cast<double>(logical_elapsed_us * us2ns) /
+                             __real_time_factor_);
+
+  const auto overrun = nowNs() > deadline_ns;
+  if (!overrun) {
+    sleepUntil(deadline_ns);
+  }
+
+  __statistics_.record(nowNs() - deadline_ns, overrun);
+}
+
+void TimeManagementPolicyRealTime::logStatistics() const {
+  auto &logger = Logger::get_instance();
+
+  logger.log(Logger::Level::NOTICE,
+             "Real-time steps " + to_string(__statistics_.steps) +
+                 ", overruns " + to_string(__statistics_.overruns));
+  logger.log(Logger::Level::NOTICE,
+             "Real-time lateness (ns) min " +
+                 to_string(__statistics_.min_lateness_ns) + ", max " +
+                 to_string(__statistics_.max_lateness_ns) + ", mean " +
+                 to_string(__statistics_.getMeanLatenessNs()) + ", jitter " +
+                 to_string(__statistics_.getJitterNs()));
+
+  for (auto i = 0U; i < RealTimeStatistics::histogram_size; ++i) {
+    if (__statistics_.histogram[i] != 0) {
+      const auto bound =
+          (i == 0) ? string("<1us")
+                   : (i == RealTimeStatistics::histogram_size - 1)
+                         ? ">=" + to_string(1U << (i - 1)) + "us"
+                         : "<" + to_string(1U << i) + "us";
+      logger.log(Logger::Level::NOTICE,
+                 "Real-time lateness " + bound + "\t" +
+                     to_string(__statistics_.histogram[i]));
+    }
+  }
+}
+
+} // namespace Seaplanes
@@ -35,4 +35,17 @@ auto TimeManagementPolicyTimeStep::getLP() -> ProtoLogicalProcessor & {
   return __up_time_management_policy_->getLP();
 }
 
+auto TimeManagementPolicyTimeStep::reflectionReceived(
+    RTI::ObjectHandle object_handle,
+    const RTI::AttributeHandleValuePairSet &values, SeaplanesTime time,
+    RTI::EventRetractionHandle handle) -> bool {
+  return __up_time_management_policy_->reflectionReceived(object_handle, values,
+                                                          time, handle);
+}
+
+auto TimeManagementPolicyTimeStep::retractionRequested(
+    RTI::EventRetractionHandle handle) -> void {
+  __up_time_management_policy_->retractionRequested(handle);
+}
+
 } // namespace Seaplanes
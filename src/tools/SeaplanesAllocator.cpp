@@ -0,0 +1,264 @@
+//! \file    SeaplanesAllocator.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Offline allocator of the models to the logical processors and
+//! cores.
+//!
+//! This tool reads the models profiles written by the logical processors,
+//! \see ProtoLogicalProcessor::setModelsProfile, with the compute time, the
+//! period and the ports of each model. A model reading an attribute written
+//! by another one depends on it. The models are allocated to the logical
+//! processors and cores, \see LogicalProcessorAllocator.h, and the
+//! allocation is written for the logical processors,
+//! \see LogicalProcessorAllocation.h.
+//!
+//! Usage: seaplanes-allocator [--exchange-cost=s] [--latency-weight=w]
+//!                            [--prefix=name] <cores> <allocation>
+//!                            <profile> [<profile> ...]
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <LogicalProcessorAllocation.h>
+#include <LogicalProcessorAllocator.h>
+
+using Seaplanes::Allocation;
+using Seaplanes::Allocator;
+using std::size_t;
+using std::string;
+using std::vector;
+
+namespace {
+
+//! Largest number of models allocated exactly.
+constexpr size_t exact_models_limit = 14;
+
+//! \brief Read the models profiles.
+//! \param paths The paths of the profiles.
+//! \param[out] problem The problem, with the models and dependencies.
+//! \throw std::runtime_error If a profile cannot be read or is malformed.
+void readProfiles(const vector<string> &paths, Allocator::Problem &problem) {
+  std::map<string, size_t> indexes;
+  std::map<string, size_t> producers;
+  vector<std::pair<string, string>> inputs;
+
+  for (const auto &path : paths) {
+    std::ifstream file(path);
+    if (!file) {
+      throw std::runtime_error("Cannot read profile " + path);
+    }
+    string line;
+    for (auto line_number = 1U; std::getline(file, line); ++line_number) {
+      std::istringstream stream(line.substr(0, line.find('#')));
+      const auto where = path + ":" + std::to_string(line_number);
+      string keyword;
+      string name;
+      if (!(stream >> keyword)) {
+        continue;
+      }
+      if (!(stream >> name)) {
+        throw std::runtime_error("Malformed profile " + where);
+      }
+
+      if (keyword == "model") {
+        Allocator::ModelProfile model{name, 0., 0.};
+        if (!(stream >> model.time >> model.period) || model.time < 0. ||
+            !(model.period > 0.)) {
+          throw std::runtime_error("Malformed model in " + where);
+        }
+        if (!indexes.emplace(name, problem.models.size()).second) {
+          throw std::runtime_error("Model " + name + " profiled twice, " +
+                                   where);
+        }
+        problem.models.push_back(model);
+        continue;
+      }
+
+      string attribute;
+      if (!(stream >> attribute) || indexes.count(name) == 0) {
+        throw std::runtime_error("Malformed port in " + where);
+      }
+      if (keyword == "input") {
+        inputs.emplace_back(name, attribute);
+      } else if (keyword == "output") {
+        producers[attribute] = indexes[name];
+      } else {
+        throw std::runtime_error("Unknown keyword " + keyword + " in " +
+                                 where);
+      }
+    }
+  }
+
+  // Attributes read from another model, the others coming from outside.
+  std::map<std::pair<size_t, size_t>, unsigned int> weights;
+  for (const auto &input : inputs) {
+    const auto it = producers.find(input.second);
+    const auto consumer = indexes[input.first];
+    if (it != producers.end() && it->second != consumer) {
+      ++weights[std::make_pair(std::min(it->second, consumer),
+                               std::max(it->second, consumer))];
+    }
+  }
+  problem.dependencies.assign(problem.models.size(),
+                              vector<Allocator::Dependency>());
+  for (const auto &weight : weights) {
+    problem.dependencies[weight.first.first].push_back(
+        Allocator::Dependency{weight.first.second, weight.second});
+    problem.dependencies[weight.first.second].push_back(
+        Allocator::Dependency{weight.first.first, weight.second});
+  }
+}
+
+//! \brief Number the logical processors used in the order of their first
+//! model, one per core.
+//! \param problem The allocation problem.
+//! \param allocator The allocation.
+//! \return The number of each logical processor, unallocated if empty.
+vector<int> numbering(const Allocator::Problem &problem,
+                      const Allocator &allocator) {
+  vector<int> numbers(problem.cores, Allocator::unallocated);
+  auto used = 0;
+  for (auto model = 0UL; model < problem.models.size(); ++model) {
+    auto &number = numbers[allocator.getLp(model)];
+    if (number == Allocator::unallocated) {
+      number = used++;
+    }
+  }
+  return (numbers);
+}
+
+//! \brief Build the partitions of an allocation.
+//! \param problem The allocation problem.
+//! \param allocator The allocation.
+//! \param numbers The number of each logical processor.
+//! \param prefix The prefix of the logical processors names.
+//! \return The partitions, by number.
+Allocation::VecPartition partitions(const Allocator::Problem &problem,
+                                    const Allocator &allocator,
+                                    const vector<int> &numbers,
+                                    const string &prefix) {
+  const auto used = static_cast<std::size_t>(std::count_if(
+      numbers.begin(), numbers.end(),
+      [](int number) { return (number != Allocator::unallocated); }));
+  Allocation::VecPartition partitions(used);
+  for (auto number = 0; number < static_cast<int>(used); ++number) {
+    partitions[number] = Allocation::Partition{
+        prefix + std::to_string(number), number, vector<string>()};
+  }
+  for (auto model = 0UL; model < problem.models.size(); ++model) {
+    partitions[numbers[allocator.getLp(model)]].models.push_back(
+        problem.models[model].name);
+  }
+  return (partitions);
+}
+
+//! \brief Print the allocation.
+//! \param allocator The allocation.
+//! \param numbers The number of each logical processor.
+//! \param partitions The partitions, by number.
+//! \param exact True if proven optimal.
+void print(const Allocator &allocator, const vector<int> &numbers,
+           const Allocation::VecPartition &partitions, bool exact) {
+  std::printf("%-12s %4s %10s %10s %6s %s\n", "LP", "CPU", "PERIOD ms",
+              "LOAD ms", "UTIL", "MODELS");
+  for (const auto &partition : partitions) {
+    const auto lp = static_cast<std::size_t>(
+        std::find(numbers.begin(), numbers.end(), partition.cpu) -
+        numbers.begin());
+    const auto utilization = allocator.getLoad(lp) / allocator.getPeriod(lp);
+    std::printf("%-12s %4d %10.3f %10.3f %6.2f", partition.lp_name.c_str(),
+                partition.cpu, allocator.getPeriod(lp) * 1e3,
+                allocator.getLoad(lp) * 1e3, utilization);
+    for (const auto &name : partition.models) {
+      std::printf(" %s", name.c_str());
+    }
+    std::printf("%s\n", utilization > 1. ? " (overloaded)" : "");
+  }
+  std::printf("makespan %.3f, dependencies between LPs %llu, cost %.6f (%s)\n",
+              allocator.getMakespan(), allocator.getCut(), allocator.getCost(),
+              exact ? "optimal" : "heuristic");
+}
+
+//! \brief Read an option value.
+//! \param argument The argument.
+//! \param option The option name, with its equal sign.
+//! \param[out] value The option value.
+//! \return True if the argument is the option.
+bool readOption(const string &argument, const string &option, string &value) {
+  if (argument.compare(0, option.size(), option) != 0) {
+    return (false);
+  }
+  value = argument.substr(option.size());
+  return (true);
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  Allocator::Problem problem;
+  string prefix = "LP";
+  vector<string> arguments;
+  try {
+    for (auto i = 1; i < argc; ++i) {
+      const string argument = argv[i];
+      string value;
+      if (readOption(argument, "--exchange-cost=", value)) {
+        problem.exchange_cost = std::stod(value);
+      } else if (readOption(argument, "--latency-weight=", value)) {
+        problem.latency_weight = std::stod(value);
+      } else if (!readOption(argument, "--prefix=", prefix)) {
+        arguments.push_back(argument);
+      }
+    }
+    if (arguments.size() >= 3) {
+      problem.cores = static_cast<unsigned int>(std::stoul(arguments[0]));
+    }
+  } catch (const std::logic_error &) {
+    arguments.clear();
+  }
+  if (arguments.size() < 3 || problem.cores == 0) {
+    std::cerr << "Usage: " << argv[0]
+              << " [--exchange-cost=s] [--latency-weight=w] [--prefix=name]"
+                 " <cores> <allocation> <profile> [<profile> ...]"
+              << std::endl;
+    return (EXIT_FAILURE);
+  }
+
+  try {
+    readProfiles(vector<string>(arguments.begin() + 2, arguments.end()),
+                 problem);
+    if (problem.models.empty()) {
+      throw std::runtime_error("No model profiled");
+    }
+
+    Allocator allocator(problem);
+    allocator.allocateGreedy();
+    allocator.improveLocally();
+
+    auto exact = false;
+    if (problem.models.size() <= exact_models_limit) {
+      exact = allocator.allocateExactly();
+    }
+
+    const auto numbers = numbering(problem, allocator);
+    const auto allocation =
+        Allocation::create(partitions(problem, allocator, numbers, prefix));
+    allocation->write(arguments[1]);
+    print(allocator, numbers, allocation->getPartitions(), exact);
+  } catch (const std::exception &e) {
+    std::cerr << argv[0] << ": " << e.what() << std::endl;
+    return (EXIT_FAILURE);
+  }
+
+  return (EXIT_SUCCESS);
+}
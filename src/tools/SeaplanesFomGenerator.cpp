@@ -0,0 +1,375 @@
+//! \file    SeaplanesFomGenerator.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   FOM classes C++ header generator.
+//!
+//! This tool reads a HLA 1.3 federation file (.fed) and generates a header
+//! with a struct per object class: the class name, constexpr attributes
+//! indexes in the FOM order, the attributes values, and typed accessors. The
+//! values are encoded and decoded by the object instances they are written to
+//! and read from. Attributes inherited from the parent classes come first.
+//! \see LogicalProcessorFomClass.h
+//!
+//! Usage: seaplanes-fom-generator <federation file> <header> [namespace]
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+namespace {
+
+//! \brief Federation file node, an atom or a list of nodes.
+struct Node {
+  string atom;        //!< Atom, empty for a list.
+  vector<Node> nodes; //!< Nodes of a list.
+  unsigned int line;  //!< Line of the node in the file.
+};
+
+//! \brief Object class, with its attributes.
+struct ObjectClass {
+  string name;               //!< Object class name.
+  string identifier;         //!< C++ struct name.
+  vector<string> attributes; //!< Attributes names, inherited first.
+};
+
+//! \brief Federation file parser, of s-expressions.
+class Parser final {
+public:
+  //! \brief Parser constructor.
+  //! \param text The federation file content.
+  explicit Parser(string text)
+      : __text_(std::move(text)), __pos_(0), __line_(1) {}
+
+  //! \brief Parse the federation file.
+  //! \return The root list.
+  //! \throw std::runtime_error On syntax error.
+  Node parse() {
+    Node root{"", {}, 1};
+    while (skip()) {
+      root.nodes.push_back(parseNode());
+    }
+    return (root);
+  }
+
+private:
+  string __text_;       //!< Federation file content.
+  std::size_t __pos_;   //!< Current position.
+  unsigned int __line_; //!< Current line.
+
+  //! \brief Skip blanks and comments.
+  //! \return True if not at the end of the text.
+  bool skip() {
+    while (__pos_ < __text_.size()) {
+      const auto c = __text_[__pos_];
+      if (c == '\n') {
+        ++__line_;
+        ++__pos_;
+      } else if (std::isspace(static_cast<unsigned char>(c)) != 0) {
+        ++__pos_;
+      } else if (c == ';') {
+        while (__pos_ < __text_.size() && __text_[__pos_] != '\n') {
+          ++__pos_;
+        }
+      } else {
+        return (true);
+      }
+    }
+    return (false);
+  }
+
+  //! \brief Parse a node.
+  //! \return The node.
+  Node parseNode() {
+    Node node{"", {}, __line_};
+    if (__text_[__pos_] == ')') {
+      throw std::runtime_error("Unexpected ')' line " +
+                               std::to_string(__line_));
+    }
+    if (__text_[__pos_] != '(') {
+      const auto quoted = __text_[__pos_] == '"';
+      const auto start = __pos_;
+      __pos_ += quoted ? 1 : 0;
+      while (__pos_ < __text_.size() &&
+             (quoted ? __text_[__pos_] != '"'
+                     : (std::isspace(static_cast<unsigned char>(
+                            __text_[__pos_])) == 0 &&
+                        __text_[__pos_] != '(' && __text_[__pos_] != ')'))) {
+        ++__pos_;
+      }
+      if (quoted) {
+        node.atom = __text_.substr(start + 1, __pos_ - start - 1);
+        ++__pos_;
+      } else {
+        node.atom = __text_.substr(start, __pos_ - start);
+      }
+      return (node);
+    }
+
+    ++__pos_;
+    while (true) {
+      if (!skip()) {
+        throw std::runtime_error("Missing ')' for line " +
+                                 std::to_string(node.line));
+      }
+      if (__text_[__pos_] == ')') {
+        ++__pos_;
+        return (node);
+      }
+      node.nodes.push_back(parseNode());
+    }
+  }
+};
+
+//! \brief Lower case a string.
+//! \param text The string.
+//! \return The lower case string.
+string lower(string text) {
+  std::transform(text.begin(), text.end(), text.begin(), [](char c) {
+    return (static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+  });
+  return (text);
+}
+
+//! \brief Get if a node is a list starting with a keyword.
+//! \param node The node.
+//! \param keyword The keyword, in lower case.
+//! \return True if the node is such a list, else false.
+bool isList(const Node &node, const string &keyword) {
+  return (!node.nodes.empty() && node.nodes[0].nodes.empty() &&
+          lower(node.nodes[0].atom) == keyword);
+}
+
+//! \brief Make a C++ identifier from a FOM name.
+//! \param name The FOM name.
+//! \param reserved Names not to use, suffixed with '_'.
+//! \return The identifier.
+string identifier(const string &name, const std::set<string> &reserved) {
+  static const std::set<string> keywords{
+      "alignas",  "alignof",   "and",      "asm",       "auto",
+      "bool",     "break",     "case",     "catch",     "char",
+      "class",    "const",     "continue", "default",   "delete",
+      "do",       "double",    "else",     "enum",      "explicit",
+      "export",   "extern",    "false",    "float",     "for",
+      "friend",   "goto",      "if",       "inline",    "int",
+      "long",     "mutable",   "namespace", "new",      "noexcept",
+      "not",      "nullptr",   "operator", "or",        "private",
+      "protected", "public",   "register", "return",    "short",
+      "signed",   "sizeof",    "static",   "struct",    "switch",
+      "template", "this",      "throw",    "true",      "try",
+      "typedef",  "typename",  "union",    "unsigned",  "using",
+      "virtual",  "void",      "volatile", "while",     "xor"};
+
+  auto result = name;
+  for (auto &c : result) {
+    if (std::isalnum(static_cast<unsigned char>(c)) == 0) {
+      c = '_';
+    }
+  }
+  if (result.empty() || std::isdigit(static_cast<unsigned char>(result[0]))) {
+    result.insert(0, "_");
+  }
+  while (keywords.count(result) != 0 || reserved.count(result) != 0) {
+    result += '_';
+  }
+  return (result);
+}
+
+//! \brief Collect the object classes of a class node and its subclasses.
+//! \param node The class node.
+//! \param inherited The attributes inherited from the parent classes.
+//! \param[out] classes The object classes.
+void collectClasses(const Node &node, vector<string> inherited,
+                    vector<ObjectClass> &classes) {
+  if (node.nodes.size() < 2 || !node.nodes[1].nodes.empty()) {
+    throw std::runtime_error("Unnamed class line " + std::to_string(node.line));
+  }
+  const auto &name = node.nodes[1].atom;
+
+  for (const auto &child : node.nodes) {
+    if (isList(child, "attribute") && child.nodes.size() >= 2) {
+      // The RTI private attribute is not for the federates.
+      if (child.nodes[1].atom != "privilegeToDelete") {
+        inherited.push_back(child.nodes[1].atom);
+      }
+    }
+  }
+
+  if (name != "ObjectRoot" && name != "RTIprivate") {
+    classes.push_back(ObjectClass{name, "", inherited});
+  }
+
+  for (const auto &child : node.nodes) {
+    if (isList(child, "class")) {
+      collectClasses(child, inherited, classes);
+    }
+  }
+}
+
+//! \brief Collect the object classes of a federation file.
+//! \param root The federation file root node.
+//! \return The object classes.
+vector<ObjectClass> collectClasses(const Node &root) {
+  vector<ObjectClass> classes;
+  const Node *p_fed = &root;
+  if (root.nodes.size() == 1 && isList(root.nodes[0], "fed")) {
+    p_fed = &root.nodes[0];
+  }
+  for (const auto &node : p_fed->nodes) {
+    if (isList(node, "objects")) {
+      for (const auto &child : node.nodes) {
+        if (isList(child, "class")) {
+          collectClasses(child, {}, classes);
+        }
+      }
+    }
+  }
+
+  std::set<string> identifiers;
+  for (auto &object_class : classes) {
+    object_class.identifier = identifier(object_class.name, identifiers);
+    identifiers.insert(object_class.identifier);
+  }
+  return (classes);
+}
+
+//! \brief Generate the struct of an object class.
+//! \param object_class The object class.
+//! \param out The output stream.
+void generateClass(const ObjectClass &object_class, std::ostream &out) {
+  static const std::set<string> members{
+      "values", "getClassName", "getAttributesNames", "attributes_number",
+      "Index"};
+
+  vector<string> accessors;
+  std::set<string> used(members);
+  for (const auto &attribute : object_class.attributes) {
+    accessors.push_back(identifier(attribute, used));
+    used.insert(accessors.back());
+  }
+  const auto &id = object_class.identifier;
+  const auto number = object_class.attributes.size();
+
+  out << "//! \\brief " << object_class.name << " object class.\n"
+      << "struct " << id << " final {\n"
+      << "  //! \\brief Object class name.\n"
+      << "  //! \\return The object class name, in the FOM.\n"
+      << "  static constexpr const char *getClassName() { return (\""
+      << object_class.name << "\"); }\n\n"
+      << "  //! Number of attributes.\n"
+      << "  static constexpr std::size_t attributes_number = " << number
+      << ";\n\n"
+      << "  //! \\brief Attributes indexes, in the FOM order.\n"
+      << "  struct Index {\n";
+  for (auto i = 0UL; i < number; ++i) {
+    out << "    static constexpr std::size_t " << accessors[i] << " = " << i
+        << ";\n";
+  }
+  out << "  };\n\n"
+      << "  //! \\brief Attributes names.\n"
+      << "  //! \\return The attributes names, in the indexes order.\n"
+      << "  static std::vector<Name> getAttributesNames() {\n"
+      << "    return (std::vector<Name>{";
+  for (auto i = 0UL; i < number; ++i) {
+    out << (i == 0 ? "" : ", ") << '"' << object_class.attributes[i] << '"';
+  }
+  out << "});\n"
+      << "  }\n\n"
+      << "  //! Attributes values, by index.\n"
+      << "  std::array<double, attributes_number> values;\n";
+  for (auto i = 0UL; i < number; ++i) {
+    out << "\n"
+        << "  //! \\brief " << object_class.attributes[i]
+        << " value accessor.\n"
+        << "  //! \\return The value.\n"
+        << "  double &" << accessors[i] << "() { return (values[Index::"
+        << accessors[i] << "]); }\n\n"
+        << "  //! \\brief " << object_class.attributes[i] << " value getter.\n"
+        << "  //! \\return The value.\n"
+        << "  double " << accessors[i]
+        << "() const { return (values[Index::" << accessors[i] << "]); }\n";
+  }
+  out << "};\n\n";
+}
+
+//! \brief Generate the header of the object classes.
+//! \param classes The object classes.
+//! \param fed_name The federation file name.
+//! \param header_name The header file name.
+//! \param name_space The namespace of the classes.
+//! \param out The output stream.
+void generateHeader(const vector<ObjectClass> &classes, const string &fed_name,
+                    const string &header_name, const string &name_space,
+                    std::ostream &out) {
+  auto guard = identifier(header_name, {});
+  std::transform(guard.begin(), guard.end(), guard.begin(), [](char c) {
+    return (static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
+  });
+
+  out << "//! \\file    " << header_name << "\n"
+      << "//! \\brief   FOM classes of " << fed_name << ".\n"
+      << "//!\n"
+      << "//! Generated by seaplanes-fom-generator, do not edit.\n\n"
+      << "#ifndef " << guard << "\n"
+      << "#define " << guard << "\n\n"
+      << "#include <array>\n"
+      << "#include <cstddef>\n"
+      << "#include <vector>\n\n"
+      << "#include <LogicalProcessorCommon.h>\n\n"
+      << "namespace " << name_space << " {\n\n";
+  for (const auto &object_class : classes) {
+    generateClass(object_class, out);
+  }
+  out << "} // namespace " << name_space << "\n\n"
+      << "#endif // " << guard << "\n";
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  if (argc < 3 || argc > 4) {
+    std::cerr << "Usage: " << argv[0]
+              << " <federation file> <header> [namespace]" << std::endl;
+    return (EXIT_FAILURE);
+  }
+  const string fed_path = argv[1];
+  const string header_path = argv[2];
+  const string name_space = argc == 4 ? argv[3] : "Fom";
+
+  try {
+    std::ifstream fed(fed_path);
+    if (!fed) {
+      throw std::runtime_error("Cannot read " + fed_path);
+    }
+    std::ostringstream text;
+    text << fed.rdbuf();
+
+    const auto classes = collectClasses(Parser(text.str()).parse());
+    if (classes.empty()) {
+      throw std::runtime_error("No object class in " + fed_path);
+    }
+
+    std::ofstream header(header_path);
+    generateHeader(classes, fed_path.substr(fed_path.find_last_of('/') + 1),
+                   header_path.substr(header_path.find_last_of('/') + 1),
+                   name_space, header);
+    if (!header) {
+      throw std::runtime_error("Cannot write " + header_path);
+    }
+  } catch (const std::exception &e) {
+    std::cerr << argv[0] << ": " << e.what() << std::endl;
+    return (EXIT_FAILURE);
+  }
+
+  return (EXIT_SUCCESS);
+}
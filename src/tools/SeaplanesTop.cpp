@@ -0,0 +1,157 @@
+//! \file    SeaplanesTop.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Live metrics reader of the federates of a host.
+//!
+//! This tool lists the metrics segments of the logical processors running on
+//! the host, \see LogicalProcessorMetrics.h, and prints their metrics,
+//! refreshed periodically. The segments are mapped read only, and read
+//! without locking, so the federates are not perturbed.
+//!
+//! Usage: seaplanes-top [period in seconds, 0 to print once]
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <LogicalProcessorMetrics.h>
+
+using Seaplanes::Metrics;
+using std::string;
+using std::vector;
+
+namespace {
+
+//! Directory of the shared memory segments.
+constexpr const char *shm_directory = "/dev/shm";
+
+//! \brief Metrics of a federate, with its segment.
+struct Federate {
+  string segment;             //!< Segment name.
+  Metrics::Snapshot snapshot; //!< Metrics read.
+};
+
+//! \brief List the metrics segments.
+//! \return The segments names.
+vector<string> listSegments() {
+  vector<string> segments;
+  const string prefix = Metrics::prefix + 1;
+
+  auto *const p_dir = opendir(shm_directory);
+  if (p_dir == nullptr) {
+    return (segments);
+  }
+  while (const auto *const p_entry = readdir(p_dir)) {
+    const string name = p_entry->d_name;
+    if (name.compare(0, prefix.size(), prefix) == 0) {
+      segments.push_back("/" + name);
+    }
+  }
+  closedir(p_dir);
+
+  std::sort(segments.begin(), segments.end());
+  return (segments);
+}
+
+//! \brief Read the metrics of a segment.
+//! \param segment The segment name.
+//! \param[out] snapshot The metrics.
+//! \return True if read, else false.
+bool readSegment(const string &segment, Metrics::Snapshot &snapshot) {
+  const auto fd = shm_open(segment.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    return (false);
+  }
+
+  struct stat status {};
+  const auto size = Metrics::getSegmentSize();
+  auto done = false;
+  if (fstat(fd, &status) == 0 &&
+      static_cast<std::size_t>(status.st_size) >= size) {
+    auto *const p_segment = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    if (p_segment != MAP_FAILED) {
+      done = Metrics::read(p_segment, snapshot);
+      munmap(p_segment, size);
+    }
+  }
+  close(fd);
+  return (done);
+}
+
+//! \brief Print the metrics of the federates.
+//! \param federates The federates.
+void print(const vector<Federate> &federates) {
+  std::printf("%-16s %7s %9s %9s %9s %9s %6s %8s %8s %8s %8s %8s %10s %10s "
+              "%10s %10s\n",
+              "FEDERATE", "PID", "STEP", "TIME", "LIMIT", "STEPS/S", "RTF",
+              "RECV ms", "CALC ms", "SEND ms", "TA ms", "WAIT ms", "RX VALUES",
+              "RX BYTES", "TX VALUES", "TX BYTES");
+  for (const auto &federate : federates) {
+    const auto &s = federate.snapshot;
+    // Processes gone without removing their segments.
+    const auto alive =
+        kill(static_cast<pid_t>(s.pid), 0) == 0 || errno != ESRCH;
+    std::printf("%-16.16s %7lld %9llu %9.3f %9.3f %9.1f %6.2f %8.3f %8.3f "
+                "%8.3f %8.3f %8.3f %10llu %10llu %10llu %10llu%s\n",
+                s.federate_name, static_cast<long long>(s.pid),
+                static_cast<unsigned long long>(s.step_number), s.local_time,
+                s.time_limit, s.steps_per_second, s.real_time_factor,
+                s.phases_times[0] * 1e3, s.phases_times[1] * 1e3,
+                s.phases_times[2] * 1e3, s.phases_times[3] * 1e3,
+                s.grant_wait_time * 1e3,
+                static_cast<unsigned long long>(s.values_received),
+                static_cast<unsigned long long>(s.bytes_received),
+                static_cast<unsigned long long>(s.values_sent),
+                static_cast<unsigned long long>(s.bytes_sent),
+                alive ? "" : " (stale)");
+  }
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  if (argc > 2) {
+    std::fprintf(stderr, "Usage: %s [period in seconds, 0 to print once]\n",
+                 argv[0]);
+    return (EXIT_FAILURE);
+  }
+  const auto period = argc == 2 ? std::atof(argv[1]) : 1.;
+
+  while (true) {
+    vector<Federate> federates;
+    for (const auto &segment : listSegments()) {
+      Federate federate{segment, Metrics::Snapshot()};
+      if (readSegment(segment, federate.snapshot)) {
+        federates.push_back(federate);
+      }
+    }
+
+    if (period > 0.) {
+      // Clear the terminal.
+      std::printf("\033[H\033[2J");
+    }
+    print(federates);
+    std::fflush(stdout);
+
+    if (period <= 0.) {
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::duration<double>(period));
+  }
+
+  return (EXIT_SUCCESS);
+}
@@ -0,0 +1,418 @@
+//! \file    SeaplanesTransportBench.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Loopback latency and throughput benchmark of the transports.
+//!
+//! Two federates, a ping and a pong, run on the host of the RTIG. The ping
+//! updates an attribute, without time stamp, with the transport under test,
+//! and the pong echoes each update back, giving the round trip latency. The
+//! ping then sends a burst of updates, counted by the pong, giving the
+//! throughput and, in best effort, the losses. Comparing a reliable run and a
+//! best effort run tells if best effort attributes, \see
+//! Attribute::setTransport, are worth it on a platform.
+//!
+//! The federation file declares the object classes BenchPing and BenchPong,
+//! with an attribute Payload each, \see res/SeaplanesTransportBench.fed.
+//!
+//! Usage: seaplanes-transport-bench [--transport=reliable|best-effort]
+//!                                  [--updates=n] [--size=bytes]
+//!                                  <ping|pong> <federation file>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <NullFederateAmbassador.hh>
+#include <RTI.hh>
+
+using std::size_t;
+using std::string;
+using std::vector;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+//! Name of the federation.
+constexpr const char *federation_name = "SeaplanesTransportBench";
+
+//! Names of the object classes, sent by the ping and by the pong.
+constexpr const char *ping_class_name = "BenchPing";
+constexpr const char *pong_class_name = "BenchPong";
+
+//! Name of the attribute of both classes.
+constexpr const char *payload_name = "Payload";
+
+//! Time waited for messages by a tick, in seconds.
+constexpr double tick_time = 1e-4;
+
+//! Time waited for an echo or a report before giving up, in seconds.
+constexpr double reply_timeout = 1.;
+
+//! Number of reports requested before giving up.
+constexpr unsigned int report_attempts = 10;
+
+//! \brief Kinds of updates, first word of the payload.
+enum Kind : std::uint32_t {
+  ECHO,   //!< To echo, for the latency.
+  BURST,  //!< To count, for the throughput.
+  REPORT, //!< To answer with the count of the burst.
+};
+
+//! \brief Header of the payload, the rest being padding.
+struct Header {
+  std::uint32_t kind;     //!< Kind of update.
+  std::uint32_t sequence; //!< Sequence number, or count of a report.
+};
+
+//! \brief Type for attribute handle value pair set unique pointer.
+using UpAttributeSet = std::unique_ptr<RTI::AttributeHandleValuePairSet>;
+
+//! \brief Type for attribute handle set unique pointer.
+using UpAttributeHandleSet = std::unique_ptr<RTI::AttributeHandleSet>;
+
+//! \brief Federate of the benchmark, ping or pong.
+class BenchFederate final : public NullFederateAmbassador {
+public:
+  //! \brief Benchmark federate constructor.
+  //! \param ping True for the ping, else the pong.
+  //! \param size The size of the payload, in bytes.
+  BenchFederate(bool ping, size_t size)
+      : __rti_amb_(), __ping_(ping), __payload_(size, 0), __received_(),
+        __peer_discovered_(false), __peer_removed_(false),
+        __reply_pending_(false), __burst_count_(0), __attribute_handle_(0),
+        __instance_handle_(0),
+        __up_values_(RTI::AttributeSetFactory::create(1)) {}
+
+  BenchFederate(const BenchFederate &) = delete;
+  void operator=(const BenchFederate &) = delete;
+  BenchFederate(BenchFederate &&) = delete;
+  void operator=(BenchFederate &&) = delete;
+  ~BenchFederate() override = default;
+
+  //! \brief Create and join the federation, publish and subscribe, register
+  //! the instance with the transport under test.
+  //! \param federation_file The federation file.
+  //! \param transport The transportation type name.
+  void joining(const string &federation_file, const string &transport) {
+    try {
+      __rti_amb_.createFederationExecution(federation_name,
+                                           federation_file.c_str());
+    } catch (const RTI::FederationExecutionAlreadyExists &) {
+      // Created by the other federate.
+    }
+    __rti_amb_.joinFederationExecution(__ping_ ? "ping" : "pong",
+                                       federation_name, this);
+
+    const auto sent_class =
+        __rti_amb_.getObjectClassHandle(__ping_ ? ping_class_name
+                                                : pong_class_name);
+    const auto received_class =
+        __rti_amb_.getObjectClassHandle(__ping_ ? pong_class_name
+                                                : ping_class_name);
+    __attribute_handle_ =
+        __rti_amb_.getAttributeHandle(payload_name, sent_class);
+
+    UpAttributeHandleSet up_attributes(
+        RTI::AttributeHandleSetFactory::create(1));
+    up_attributes->add(__attribute_handle_);
+    __rti_amb_.publishObjectClass(sent_class, *up_attributes);
+
+    // Subscribed before registering: a discovered instance tells the peer
+    // subscribes to the instance of this federate.
+    UpAttributeHandleSet up_received_attributes(
+        RTI::AttributeHandleSetFactory::create(1));
+    up_received_attributes->add(
+        __rti_amb_.getAttributeHandle(payload_name, received_class));
+    __rti_amb_.subscribeObjectClassAttributes(received_class,
+                                              *up_received_attributes);
+
+    __instance_handle_ = __rti_amb_.registerObjectInstance(sent_class);
+    __rti_amb_.changeAttributeTransportationType(
+        __instance_handle_, *up_attributes,
+        __rti_amb_.getTransportationHandle(transport.c_str()));
+  }
+
+  //! \brief Delete the instance, resign and destroy the federation if last.
+  void leaving() {
+    __rti_amb_.deleteObjectInstance(__instance_handle_, "");
+    __rti_amb_.resignFederationExecution(RTI::DELETE_OBJECTS);
+    try {
+      __rti_amb_.destroyFederationExecution(federation_name);
+    } catch (const RTI::FederatesCurrentlyJoined &) {
+      // Destroyed by the other federate.
+    }
+  }
+
+  //! \brief Wait for the instance of the peer.
+  void discoveryWaiting() {
+    while (!__peer_discovered_) {
+      __rti_amb_.tick(tick_time, tick_time);
+    }
+  }
+
+  //! \brief Pong loop, echoing and counting the updates of the ping until
+  //! its instance is removed.
+  void ponging() {
+    while (!__peer_removed_) {
+      __rti_amb_.tick(tick_time, tick_time);
+      // The RTI is not reentrant, the echoes are sent out of the callbacks.
+      if (__reply_pending_) {
+        __reply_pending_ = false;
+        sending(__received_.kind, __received_.kind == REPORT
+                                      ? __burst_count_
+                                      : __received_.sequence);
+      }
+    }
+  }
+
+  //! \brief Measure the round trip latencies.
+  //! \param updates The number of round trips.
+  //! \param[out] latencies The round trip latencies of the echoed updates, in
+  //! seconds.
+  //! \return The number of updates not echoed in time.
+  unsigned int latencyMeasuring(unsigned int updates,
+                                vector<double> &latencies) {
+    auto lost = 0U;
+    latencies.clear();
+    latencies.reserve(updates);
+    for (auto sequence = 0U; sequence < updates; ++sequence) {
+      const auto start = Clock::now();
+      sending(ECHO, sequence);
+      if (replyWaiting(ECHO, sequence)) {
+        latencies.push_back(
+            std::chrono::duration<double>(Clock::now() - start).count());
+      } else {
+        ++lost;
+      }
+    }
+    return (lost);
+  }
+
+  //! \brief Measure the throughput of a burst.
+  //! \param updates The number of updates of the burst.
+  //! \param[out] elapsed The time from the first update to the report, in
+  //! seconds.
+  //! \return The number of updates received by the pong.
+  unsigned int throughputMeasuring(unsigned int updates, double &elapsed) {
+    const auto start = Clock::now();
+    for (auto sequence = 0U; sequence < updates; ++sequence) {
+      sending(BURST, sequence);
+    }
+    // Reports may be lost in best effort, asked again.
+    for (auto attempt = 0U; attempt < report_attempts; ++attempt) {
+      sending(REPORT, attempt);
+      if (replyWaiting(REPORT, attempt)) {
+        elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        return (__burst_count_);
+      }
+    }
+    throw std::runtime_error("No report from the pong");
+  }
+
+  void discoverObjectInstance(RTI::ObjectHandle /* object_handle */,
+                              RTI::ObjectClassHandle /* class_handle */,
+                              const char /* name */[]) noexcept final {
+    __peer_discovered_ = true;
+  }
+
+  void removeObjectInstance(RTI::ObjectHandle /* object_handle */,
+                            const char /* tag */[]) noexcept final {
+    __peer_removed_ = true;
+  }
+
+  void
+  reflectAttributeValues(RTI::ObjectHandle /* handle */,
+                         const RTI::AttributeHandleValuePairSet &values,
+                         const char /* tag */[]) noexcept final {
+    if (values.size() == 0) {
+      return;
+    }
+    RTI::ULong length = 0;
+    const auto *const p_value = values.getValuePointer(0, length);
+    if (p_value == nullptr || length < sizeof(Header)) {
+      return;
+    }
+    Header header{};
+    std::memcpy(&header, p_value, sizeof(Header));
+    if (!__ping_ && header.kind == BURST) {
+      ++__burst_count_;
+      return;
+    }
+    __received_ = header;
+    __reply_pending_ = true;
+  }
+
+private:
+  RTI::RTIambassador __rti_amb_; //!< RTI ambassador.
+  bool __ping_;                  //!< True for the ping, else the pong.
+  vector<char> __payload_;       //!< Payload sent.
+  Header __received_;            //!< Header of the last payload received.
+
+  bool __peer_discovered_; //!< True once the peer instance is discovered.
+  bool __peer_removed_;    //!< True once the peer instance is removed.
+  bool __reply_pending_;   //!< True if a reply is to send, or received.
+
+  //! Updates of the burst received by the pong, or count reported to the
+  //! ping.
+  std::uint32_t __burst_count_;
+
+  RTI::AttributeHandle __attribute_handle_; //!< Payload attribute handle.
+  RTI::ObjectHandle __instance_handle_;     //!< Instance sent.
+  UpAttributeSet __up_values_;              //!< Values sent.
+
+  //! \brief Send an update, without time stamp.
+  //! \param kind The kind of update.
+  //! \param sequence The sequence number, or the count of a report.
+  void sending(std::uint32_t kind, std::uint32_t sequence) {
+    const Header header{kind, sequence};
+    std::memcpy(__payload_.data(), &header, sizeof(Header));
+    __up_values_->empty();
+    __up_values_->add(__attribute_handle_, __payload_.data(),
+                      static_cast<RTI::ULong>(__payload_.size()));
+    __rti_amb_.updateAttributeValues(__instance_handle_, *__up_values_, "");
+  }
+
+  //! \brief Wait for the reply of the pong, stale replies being ignored.
+  //! \param kind The kind of update replied to.
+  //! \param sequence The sequence number replied to.
+  //! \return True if replied in time, else false.
+  bool replyWaiting(std::uint32_t kind, std::uint32_t sequence) {
+    const auto deadline =
+        Clock::now() + std::chrono::duration<double>(reply_timeout);
+    while (Clock::now() < deadline) {
+      __rti_amb_.tick(tick_time, tick_time);
+      if (!__reply_pending_) {
+        continue;
+      }
+      __reply_pending_ = false;
+      if (__received_.kind != kind) {
+        continue;
+      }
+      if (kind == REPORT) {
+        __burst_count_ = __received_.sequence;
+        return (true);
+      }
+      if (__received_.sequence == sequence) {
+        return (true);
+      }
+    }
+    return (false);
+  }
+};
+
+//! \brief Read an option value.
+//! \param argument The argument.
+//! \param option The option name, with its equal sign.
+//! \param[out] value The option value.
+//! \return True if the argument is the option.
+bool readOption(const string &argument, const string &option, string &value) {
+  if (argument.compare(0, option.size(), option) != 0) {
+    return (false);
+  }
+  value = argument.substr(option.size());
+  return (true);
+}
+
+//! \brief Print the latency and the throughput measured.
+//! \param transport The transportation type name.
+//! \param size The size of the payload, in bytes.
+//! \param latencies The round trip latencies, in seconds.
+//! \param echoes_lost The number of updates not echoed.
+//! \param updates The number of updates of the burst.
+//! \param received The number of updates of the burst received.
+//! \param elapsed The duration of the burst, in seconds.
+void print(const string &transport, size_t size, vector<double> latencies,
+           unsigned int echoes_lost, unsigned int updates,
+           unsigned int received, double elapsed) {
+  std::printf("transport %s, payload %zu bytes\n", transport.c_str(), size);
+  if (latencies.empty()) {
+    std::printf("latency: no update echoed, %u lost\n", echoes_lost);
+  } else {
+    std::sort(latencies.begin(), latencies.end());
+    const auto percentile = [&latencies](double ratio) {
+      return (latencies[static_cast<size_t>(
+                  ratio * static_cast<double>(latencies.size() - 1))] *
+              1e6);
+    };
+    std::printf("latency (round trip, us): min %.1f, median %.1f, p99 %.1f, "
+                "max %.1f, %u lost\n",
+                percentile(0.), percentile(.5), percentile(.99),
+                percentile(1.), echoes_lost);
+  }
+  const auto rate = elapsed > 0. ? received / elapsed : 0.;
+  std::printf("throughput: %u/%u updates received (%.2f%% lost), %.0f "
+              "updates/s, %.3f MB/s\n",
+              received, updates,
+              updates == 0 ? 0. : 100. * (updates - received) / updates, rate,
+              rate * static_cast<double>(size) * 1e-6);
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  string transport = "reliable";
+  auto updates = 10000U;
+  size_t size = 64;
+  vector<string> arguments;
+  try {
+    for (auto i = 1; i < argc; ++i) {
+      const string argument = argv[i];
+      string value;
+      if (readOption(argument, "--updates=", value)) {
+        updates = static_cast<unsigned int>(std::stoul(value));
+      } else if (readOption(argument, "--size=", value)) {
+        size = std::max(std::stoul(value), sizeof(Header));
+      } else if (!readOption(argument, "--transport=", transport)) {
+        arguments.push_back(argument);
+      }
+    }
+  } catch (const std::logic_error &) {
+    arguments.clear();
+  }
+  if (arguments.size() != 2 ||
+      (arguments[0] != "ping" && arguments[0] != "pong") ||
+      (transport != "reliable" && transport != "best-effort")) {
+    std::cerr << "Usage: " << argv[0]
+              << " [--transport=reliable|best-effort] [--updates=n]"
+                 " [--size=bytes] <ping|pong> <federation file>"
+              << std::endl;
+    return (EXIT_FAILURE);
+  }
+
+  const auto ping = arguments[0] == "ping";
+  const auto transportation =
+      transport == "reliable" ? "HLAreliable" : "HLAbestEffort";
+  try {
+    BenchFederate federate(ping, size);
+    federate.joining(arguments[1], transportation);
+    federate.discoveryWaiting();
+    if (ping) {
+      vector<double> latencies;
+      const auto echoes_lost = federate.latencyMeasuring(updates, latencies);
+      auto elapsed = 0.;
+      const auto received = federate.throughputMeasuring(updates, elapsed);
+      print(transport, size, latencies, echoes_lost, updates, received,
+            elapsed);
+    } else {
+      federate.ponging();
+    }
+    federate.leaving();
+  } catch (const RTI::Exception &e) {
+    std::cerr << argv[0] << ": " << e._name << " " << e._reason << std::endl;
+    return (EXIT_FAILURE);
+  } catch (const std::exception &e) {
+    std::cerr << argv[0] << ": " << e.what() << std::endl;
+    return (EXIT_FAILURE);
+  }
+
+  return (EXIT_SUCCESS);
+}
@@ -0,0 +1,42 @@
+template <class C> void checkFomClass(const SpObject &sp_object) {
+  if (sp_object->getName() != C::getClassName()) {
+    throw std::invalid_argument("Object class " + sp_object->getName() +
+                                " is not the FOM class " + C::getClassName());
+  }
+}
+
+template <class C>
+UpObjectInstancePublished createFomPublished(Name name, SpObject sp_object) {
+  checkFomClass<C>(sp_object);
+  auto up_instance =
+      ObjectInstancePublished::create(move(name), move(sp_object));
+  for (const auto &attribute_name : C::getAttributesNames()) {
+    up_instance->addAttribute(Attribute::create(attribute_name));
+  }
+  return (up_instance);
+}
+
+template <class C>
+UpObjectInstanceSubscribed createFomSubscribed(Name name, SpObject sp_object) {
+  checkFomClass<C>(sp_object);
+  auto up_instance =
+      ObjectInstanceSubscribed::create(move(name), move(sp_object));
+  for (const auto &attribute_name : C::getAttributesNames()) {
+    up_instance->addAttribute(Attribute::create(attribute_name));
+  }
+  return (up_instance);
+}
+
+template <class C>
+void readFomValues(const ObjectInstance &instance, C &values) {
+  for (auto i = 0UL; i < C::attributes_number; ++i) {
+    values.values[i] = instance.getAttributeValue(i);
+  }
+}
+
+template <class C>
+void writeFomValues(ObjectInstance &instance, const C &values) {
+  for (auto i = 0UL; i < C::attributes_number; ++i) {
+    instance.setAttributeValue(i, values.values[i]);
+  }
+}
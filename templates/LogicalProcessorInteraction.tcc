@@ -0,0 +1,21 @@
+template <typename T>
+void Interaction::setParameter(std::size_t index, T value) {
+  static_assert(std::is_arithmetic<T>::value,
+                "Interaction parameters are arithmetic values");
+  __values_[index] = static_cast<double>(value);
+}
+
+template <typename T>
+void Interaction::setParameter(const Name &name, T value) {
+  setParameter(__sp_interaction_class_->getParameterIndex(name), value);
+}
+
+template <typename T> T Interaction::getParameter(std::size_t index) const {
+  static_assert(std::is_arithmetic<T>::value,
+                "Interaction parameters are arithmetic values");
+  return (static_cast<T>(__values_[index]));
+}
+
+template <typename T> T Interaction::getParameter(const Name &name) const {
+  return (getParameter<T>(__sp_interaction_class_->getParameterIndex(name)));
+}
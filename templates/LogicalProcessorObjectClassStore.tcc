@@ -0,0 +1,14 @@
+template <typename T>
+Span<T>::Span(T *p_data, std::size_t size) : __p_data_(p_data), __size_(size) {}
+
+template <typename T> T *Span<T>::data() const { return (__p_data_); }
+
+template <typename T> std::size_t Span<T>::size() const { return (__size_); }
+
+template <typename T> T &Span<T>::operator[](std::size_t index) const {
+  return (__p_data_[index]);
+}
+
+template <typename T> T *Span<T>::begin() const { return (__p_data_); }
+
+template <typename T> T *Span<T>::end() const { return (__p_data_ + __size_); }
@@ -0,0 +1,4 @@
+template <class T> T &ProtoLogicalProcessor::setTimeManagementPolicy() {
+  __up_time_management_policy_ = TimeManagementPolicyFactory::create<T>(*this);
+  return static_cast<T &>(*__up_time_management_policy_);
+}
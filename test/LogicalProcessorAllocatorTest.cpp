@@ -0,0 +1,166 @@
+//! \file    LogicalProcessorAllocatorTest.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Models allocation to the logical processors and cores tests.
+//!
+//! The branch and bound allocation is checked against the greedy one on a
+//! small partition problem it improves, and against the enumeration of all
+//! the allocations on a problem with dependencies and two periods.
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <LogicalProcessorAllocator.h>
+#include <SeaplanesTest.h>
+
+using Seaplanes::Allocator;
+using std::size_t;
+using std::vector;
+
+namespace {
+
+//! Tolerance of the costs.
+constexpr double tolerance = 1e-12;
+
+//! \brief Build a problem without dependencies.
+//! \param times The compute times of the models, in seconds.
+//! \param period The period of the models, in seconds.
+//! \param cores The number of cores.
+//! \return The allocation problem.
+Allocator::Problem partitionProblem(const vector<double> &times,
+                                    double period, unsigned int cores) {
+  Allocator::Problem problem;
+  for (const auto time : times) {
+    problem.models.push_back(Allocator::ModelProfile{
+        "m" + std::to_string(problem.models.size()), time, period});
+  }
+  problem.dependencies.resize(times.size());
+  problem.cores = cores;
+  problem.exchange_cost = 0.;
+  problem.latency_weight = 0.;
+  return (problem);
+}
+
+//! \brief Add a dependency between two models.
+//! \param problem The allocation problem.
+//! \param lhs A model index.
+//! \param rhs Another model index.
+//! \param weight The number of attributes exchanged.
+void depend(Allocator::Problem &problem, size_t lhs, size_t rhs,
+            unsigned int weight) {
+  problem.dependencies[lhs].push_back(Allocator::Dependency{rhs, weight});
+  problem.dependencies[rhs].push_back(Allocator::Dependency{lhs, weight});
+}
+
+//! \brief Least cost of the allocations, enumerated.
+//! \param allocator The allocator, the following models not allocated.
+//! \param model The index of the next model allocated.
+//! \param models_number The number of models.
+//! \param cores The number of cores.
+//! \return The least cost, negative if no allocation respects the periods.
+double leastCost(Allocator &allocator, size_t model, size_t models_number,
+                 unsigned int cores) {
+  if (model == models_number) {
+    return (allocator.getCost());
+  }
+  auto least = -1.;
+  for (auto lp = 0U; lp < cores; ++lp) {
+    if (!allocator.accepts(model, lp)) {
+      continue;
+    }
+    allocator.allocate(model, static_cast<int>(lp));
+    const auto cost = leastCost(allocator, model + 1, models_number, cores);
+    allocator.release(model);
+    if (cost >= 0. && (least < 0. || cost < least)) {
+      least = cost;
+    }
+  }
+  return (least);
+}
+
+//! \brief Check that the logical processors of an allocation hold models of
+//! a single period.
+//! \param problem The allocation problem.
+//! \param allocator The allocation.
+void checkPeriods(const Allocator::Problem &problem,
+                  const Allocator &allocator) {
+  for (auto model = 0UL; model < problem.models.size(); ++model) {
+    const auto lp = allocator.getLp(model);
+    SEAPLANES_CHECK(lp != Allocator::unallocated);
+    SEAPLANES_CHECK(allocator.getPeriod(static_cast<size_t>(lp)) ==
+                    problem.models[model].period);
+  }
+}
+
+//! \brief Check that the branch and bound improves the greedy allocation of
+//! a partition problem: 3 + 3 and 2 + 2 + 2 ms over 10 ms, where the greedy
+//! one ends with 3 + 2 + 2 and 3 + 2 ms.
+void testPartition() {
+  const auto problem =
+      partitionProblem({3e-3, 3e-3, 2e-3, 2e-3, 2e-3}, 1e-2, 2);
+  Allocator allocator(problem);
+  allocator.allocateGreedy();
+  SEAPLANES_CHECK_CLOSE(allocator.getMakespan(), 0.7, tolerance);
+
+  SEAPLANES_CHECK(allocator.allocateExactly());
+  SEAPLANES_CHECK_CLOSE(allocator.getMakespan(), 0.6, tolerance);
+  SEAPLANES_CHECK(allocator.getLp(0) != allocator.getLp(2));
+  SEAPLANES_CHECK(allocator.getLp(0) == allocator.getLp(1));
+  SEAPLANES_CHECK(allocator.getSize(0) + allocator.getSize(1) == 5);
+}
+
+//! \brief Check the branch and bound against the enumeration of the
+//! allocations, with dependencies between the models and two periods.
+void testDependencies() {
+  auto problem =
+      partitionProblem({4e-3, 3e-3, 3e-3, 2e-3, 1e-3, 5e-3, 4e-3}, 1e-2, 3);
+  problem.models[5].period = 2e-2;
+  problem.models[6].period = 2e-2;
+  problem.exchange_cost = 5e-4;
+  problem.latency_weight = 1e-2;
+  depend(problem, 0, 1, 2);
+  depend(problem, 1, 2, 1);
+  depend(problem, 2, 3, 3);
+  depend(problem, 3, 4, 1);
+  depend(problem, 0, 4, 1);
+  depend(problem, 4, 5, 2);
+  depend(problem, 5, 6, 1);
+
+  Allocator enumerated(problem);
+  const auto least = leastCost(enumerated, 0, problem.models.size(), 3);
+  SEAPLANES_CHECK(least >= 0.);
+
+  Allocator allocator(problem);
+  allocator.allocateGreedy();
+  checkPeriods(problem, allocator);
+  allocator.improveLocally();
+  checkPeriods(problem, allocator);
+  const auto heuristic = allocator.getCost();
+  SEAPLANES_CHECK(heuristic >= least - tolerance);
+
+  SEAPLANES_CHECK(allocator.allocateExactly());
+  checkPeriods(problem, allocator);
+  SEAPLANES_CHECK_CLOSE(allocator.getCost(), least, tolerance);
+  SEAPLANES_CHECK(allocator.getCost() <= heuristic + tolerance);
+}
+
+//! \brief Check that the models periods need a core each.
+void testErrors() {
+  auto problem = partitionProblem({1e-3, 1e-3, 1e-3}, 1e-2, 2);
+  problem.models[1].period = 2e-2;
+  problem.models[2].period = 4e-2;
+  Allocator allocator(problem);
+  SEAPLANES_CHECK_THROW(allocator.allocateGreedy(), std::runtime_error);
+}
+
+} // namespace
+
+int main() {
+  testPartition();
+  testDependencies();
+  testErrors();
+  return (EXIT_SUCCESS);
+}
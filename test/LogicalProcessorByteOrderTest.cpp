@@ -0,0 +1,93 @@
+//! \file    LogicalProcessorByteOrderTest.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Attribute values byte order kernels tests.
+//!
+//! Each kernel supported by the host encodes values as the scalar kernel
+//! does, whatever their number, the tails shorter than the vector width
+//! included, and decodes them back.
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include <LogicalProcessorByteOrder.h>
+#include <SeaplanesTest.h>
+
+using Seaplanes::ByteOrder;
+using std::size_t;
+using std::vector;
+
+namespace {
+
+//! Largest number of values encoded, over two AVX2 vectors and a tail.
+constexpr size_t max_count = 11;
+
+//! \brief Build values, each of different bytes.
+//! \param count The number of values.
+//! \return The values.
+vector<double> values(size_t count) {
+  vector<double> built;
+  for (auto i = 0UL; i < count; ++i) {
+    const auto x = static_cast<double>(i);
+    built.push_back(-1.5e-3 * x * x + 0.1 * x + 3.7);
+  }
+  return (built);
+}
+
+//! \brief Encode values in network byte order, byte by byte.
+//! \param built The values.
+//! \return The encoded values.
+vector<unsigned char> expected(const vector<double> &built) {
+  vector<unsigned char> bytes;
+  for (const auto value : built) {
+    std::uint64_t word;
+    std::memcpy(&word, &value, sizeof(word));
+    for (auto shift = 56; shift >= 0; shift -= 8) {
+      bytes.push_back(static_cast<unsigned char>(word >> shift));
+    }
+  }
+  return (bytes);
+}
+
+//! \brief Check the encoding and the decoding of the kernel in use.
+void checkKernel() {
+  for (auto count = 0UL; count <= max_count; ++count) {
+    const auto built = values(count);
+    // A byte past the values, not to be written.
+    vector<unsigned char> bytes(count * ByteOrder::value_size + 1, 0xa5);
+    ByteOrder::encode(built.data(), bytes.data(), count);
+    SEAPLANES_CHECK(bytes.back() == 0xa5);
+    bytes.pop_back();
+    SEAPLANES_CHECK(bytes == expected(built));
+
+    vector<double> decoded(count + 1, 42.);
+    ByteOrder::decode(bytes.data(), decoded.data(), count);
+    SEAPLANES_CHECK(decoded.back() == 42.);
+    decoded.pop_back();
+    SEAPLANES_CHECK(decoded == built);
+  }
+}
+
+//! \brief Check each kernel supported by the host.
+void testKernels() {
+  const auto kernels = ByteOrder::getKernels();
+  SEAPLANES_CHECK(!kernels.empty());
+  SEAPLANES_CHECK(ByteOrder::getKernel() == kernels.front());
+  for (const auto &kernel : kernels) {
+    ByteOrder::setKernel(kernel);
+    SEAPLANES_CHECK(ByteOrder::getKernel() == kernel);
+    checkKernel();
+  }
+  SEAPLANES_CHECK_THROW(ByteOrder::setKernel("avx512"), std::invalid_argument);
+  ByteOrder::setKernel(kernels.front());
+}
+
+} // namespace
+
+int main() {
+  testKernels();
+  return (EXIT_SUCCESS);
+}
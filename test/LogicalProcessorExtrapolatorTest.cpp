@@ -0,0 +1,191 @@
+//! \file    LogicalProcessorExtrapolatorTest.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Attribute values extrapolation and update policies tests.
+//!
+//! Polynomials of the order of the extrapolation are extrapolated exactly,
+//! the order being lowered while values are missing. Dead reckoned updates are
+//! only sent when the extrapolation is off by more than the threshold. The
+//! other update policies, the keepalives and the resets are checked with
+//! their counts.
+
+#include <algorithm>
+#include <vector>
+
+#include <LogicalProcessorExtrapolator.h>
+#include <LogicalProcessorUpdatePolicy.h>
+#include <SeaplanesTest.h>
+
+using Seaplanes::Extrapolator;
+using Seaplanes::UpdatePolicy;
+using Seaplanes::operator"" _ms;
+using Seaplanes::operator"" _s;
+using std::vector;
+
+namespace {
+
+//! Tolerance of the extrapolated values.
+constexpr double tolerance = 1e-9;
+
+//! \brief Check the zero order hold, and the extrapolation without values.
+void testZeroOrder() {
+  Extrapolator extrapolator;
+  SEAPLANES_CHECK(extrapolator.getOrder() == Extrapolator::Order::ZERO);
+  SEAPLANES_CHECK(extrapolator.empty());
+  SEAPLANES_CHECK(extrapolator.extrapolate(1_s) == 0.);
+
+  extrapolator.addSample(1_s, 3.);
+  extrapolator.addSample(2_s, 5.);
+  SEAPLANES_CHECK(!extrapolator.empty());
+  SEAPLANES_CHECK(extrapolator.extrapolate(10_s) == 5.);
+}
+
+//! \brief Check the first order hold, lowered to the zero order with a single
+//! value, and the replacement of a value at the same time.
+void testFirstOrder() {
+  Extrapolator extrapolator(Extrapolator::Order::FIRST);
+  extrapolator.addSample(1_s, 2.);
+  SEAPLANES_CHECK(extrapolator.extrapolate(3_s) == 2.);
+
+  // v = 2 * t.
+  extrapolator.addSample(2_s, 4.);
+  SEAPLANES_CHECK_CLOSE(extrapolator.extrapolate(3_s), 6., tolerance);
+  SEAPLANES_CHECK_CLOSE(extrapolator.extrapolate(2500_ms), 5., tolerance);
+
+  // The newest value replaced: v = 4 * t - 4.
+  extrapolator.addSample(2_s, 4.);
+  extrapolator.addSample(3_s, 9.);
+  extrapolator.addSample(3_s, 8.);
+  SEAPLANES_CHECK_CLOSE(extrapolator.extrapolate(4_s), 12., tolerance);
+}
+
+//! \brief Check the second order hold, lowered while values are missing, and
+//! using the newest values only.
+void testSecondOrder() {
+  Extrapolator extrapolator(Extrapolator::Order::SECOND);
+  extrapolator.addSample(0_s, 7.);
+  extrapolator.addSample(1_s, 1.);
+  SEAPLANES_CHECK_CLOSE(extrapolator.extrapolate(2_s), -5., tolerance);
+
+  // v = t^2, the first value dropped.
+  extrapolator.addSample(2_s, 4.);
+  extrapolator.addSample(3_s, 9.);
+  SEAPLANES_CHECK_CLOSE(extrapolator.extrapolate(4_s), 16., tolerance);
+  SEAPLANES_CHECK_CLOSE(extrapolator.extrapolate(2500_ms), 6.25, tolerance);
+  SEAPLANES_CHECK_CLOSE(extrapolator.extrapolate(3_s), 9., tolerance);
+}
+
+//! \brief Check that the dead reckoned updates are sent when the
+//! extrapolation of the subscribers is off by more than the threshold.
+void testDeadReckoning() {
+  auto policy = UpdatePolicy::deadReckoning(Extrapolator::Order::FIRST, 0.5);
+
+  // First value, then extrapolated by a zero order hold.
+  SEAPLANES_CHECK(policy.select(2., 1_s));
+  SEAPLANES_CHECK(policy.select(4., 2_s));
+
+  // Extrapolated to 6, then 8.
+  SEAPLANES_CHECK(!policy.select(6., 3_s));
+  SEAPLANES_CHECK(!policy.select(8.4, 4_s));
+
+  // Extrapolated to 10.
+  SEAPLANES_CHECK(policy.select(11., 5_s));
+
+  SEAPLANES_CHECK(policy.getSentNumber() == 3);
+  SEAPLANES_CHECK(policy.getSuppressedNumber() == 2);
+}
+
+//! \brief Check the sends of a policy, and its counts.
+//! \param policy The update policy.
+//! \param values The values selected, a step apart.
+//! \param expected The expected sends.
+void checkSends(UpdatePolicy &policy, const vector<double> &values,
+                const vector<bool> &expected) {
+  vector<bool> sends;
+  auto time = 0_s;
+  for (const auto value : values) {
+    sends.push_back(policy.select(value, time));
+    time = time + 1_s;
+  }
+  SEAPLANES_CHECK(sends == expected);
+
+  const auto sent = std::count(expected.begin(), expected.end(), true);
+  SEAPLANES_CHECK(policy.getSentNumber() == static_cast<unsigned long>(sent));
+  SEAPLANES_CHECK(policy.getSuppressedNumber() ==
+                  expected.size() - static_cast<unsigned long>(sent));
+}
+
+//! \brief Check the policies sending on change, the first value always sent.
+void testOnChange() {
+  auto always = UpdatePolicy::always();
+  checkSends(always, {1., 1., 1.}, {true, true, true});
+
+  auto on_change = UpdatePolicy::onChange();
+  checkSends(on_change, {1., 1., 2., 2., 1.},
+             {true, false, true, false, true});
+  SEAPLANES_CHECK(on_change.getKind() == UpdatePolicy::Kind::ON_CHANGE);
+}
+
+//! \brief Check the absolute and relative dead-bands, from the last value
+//! sent, any change from zero being out of the relative dead-band.
+void testDeadBand() {
+  auto dead_band = UpdatePolicy::deadBand(0.5);
+  checkSends(dead_band, {0., 0.4, 0.6, 1., 1.2},
+             {true, false, true, false, true});
+
+  auto relative = UpdatePolicy::relativeDeadBand(0.1);
+  checkSends(relative, {0., 0., 1e-9, 0.5, 0.54, 0.56},
+             {true, false, true, true, false, true});
+}
+
+//! \brief Check the decimation, a value sent every N updates.
+void testDecimation() {
+  auto decimation = UpdatePolicy::decimation(3);
+  checkSends(decimation, {1., 2., 3., 4., 5., 6., 7.},
+             {true, false, false, true, false, false, true});
+}
+
+//! \brief Check the keepalives of the maximum age.
+void testMaxAge() {
+  auto policy = UpdatePolicy::onChange().setMaxAge(3);
+  checkSends(policy, {1., 1., 1., 1., 2., 2.},
+             {true, false, false, true, true, false});
+  SEAPLANES_CHECK(policy.getKeepalivesNumber() == 1);
+}
+
+//! \brief Check that a reset policy sends its next value, for new
+//! subscribers, its counts kept.
+void testReset() {
+  auto policy = UpdatePolicy::onChange();
+  SEAPLANES_CHECK(policy.select(1., 0_s));
+  SEAPLANES_CHECK(!policy.select(1., 1_s));
+  policy.reset();
+  SEAPLANES_CHECK(policy.select(1., 2_s));
+  SEAPLANES_CHECK(!policy.select(1., 3_s));
+  SEAPLANES_CHECK(policy.getSentNumber() == 2);
+  SEAPLANES_CHECK(policy.getSuppressedNumber() == 2);
+
+  // The subscribers extrapolation restarts from the next value sent.
+  auto reckoning = UpdatePolicy::deadReckoning(Extrapolator::Order::FIRST, 0.5);
+  SEAPLANES_CHECK(reckoning.select(0., 0_s));
+  SEAPLANES_CHECK(reckoning.select(2., 1_s));
+  reckoning.reset();
+  SEAPLANES_CHECK(reckoning.select(2., 2_s));
+  SEAPLANES_CHECK(!reckoning.select(2., 3_s));
+}
+
+} // namespace
+
+int main() {
+  testZeroOrder();
+  testFirstOrder();
+  testSecondOrder();
+  testDeadReckoning();
+  testOnChange();
+  testDeadBand();
+  testDecimation();
+  testMaxAge();
+  testReset();
+  return (EXIT_SUCCESS);
+}
@@ -0,0 +1,132 @@
+//! \file    LogicalProcessorFomClassTest.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Typed object instances of generated FOM classes tests.
+//!
+//! The FOM classes are generated from TestFom.fed at build time. Typed values
+//! are written to a published object instance, sent as its updates encode
+//! them, reflected by a subscribed object instance and read back, with and
+//! without struct-of-arrays stores.
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <LogicalProcessorByteOrder.h>
+#include <LogicalProcessorFomClass.h>
+#include <SeaplanesTest.h>
+#include <TestFom.h>
+
+using Seaplanes::ByteOrder;
+using Seaplanes::Object;
+using Seaplanes::ObjectClassStore;
+using Seaplanes::createFomPublished;
+using Seaplanes::createFomSubscribed;
+using Seaplanes::readFomValues;
+using Seaplanes::writeFomValues;
+using Seaplanes::operator"" _s;
+using std::size_t;
+using std::vector;
+
+namespace {
+
+//! Number of attributes of the tested FOM class.
+constexpr size_t attributes_number = Fom::Seaplane::attributes_number;
+
+//! \brief Check the generated indexes, the inherited attributes first.
+void testIndexes() {
+  SEAPLANES_CHECK(Fom::Aircraft::attributes_number == 2);
+  SEAPLANES_CHECK(attributes_number == 3);
+  SEAPLANES_CHECK(Fom::Seaplane::Index::x == 0);
+  SEAPLANES_CHECK(Fom::Seaplane::Index::y == 1);
+  SEAPLANES_CHECK(Fom::Seaplane::Index::float_ == 2);
+  SEAPLANES_CHECK(Fom::Seaplane::getAttributesNames() ==
+                  (vector<Name>{"x", "y", "float"}));
+}
+
+//! \brief Check that the object instances are only created for the object
+//! class of their FOM class, with the attributes in the FOM order.
+void testObjectClass() {
+  const auto sp_object = Object::create(Fom::Aircraft::getClassName());
+  SEAPLANES_CHECK_THROW(createFomPublished<Fom::Seaplane>("s", sp_object),
+                        std::invalid_argument);
+  SEAPLANES_CHECK_THROW(createFomSubscribed<Fom::Seaplane>("s", sp_object),
+                        std::invalid_argument);
+
+  const auto up_instance = createFomPublished<Fom::Aircraft>("a", sp_object);
+  const auto &sp_attributes = up_instance->getAttributes();
+  SEAPLANES_CHECK(sp_attributes.size() == Fom::Aircraft::attributes_number);
+  SEAPLANES_CHECK(sp_attributes[Fom::Aircraft::Index::y]->getName() == "y");
+}
+
+//! \brief Write typed values to a published object instance, send them as
+//! its updates encode them, reflect them to a subscribed object instance and
+//! read them back.
+//! \param stored True for object instances bound to stores, else false.
+void testRoundTrip(bool stored) {
+  const auto sp_object = Object::create(Fom::Seaplane::getClassName());
+  auto up_published = createFomPublished<Fom::Seaplane>("s", sp_object);
+  auto up_subscribed = createFomSubscribed<Fom::Seaplane>("s", sp_object);
+  if (stored) {
+    up_published->setStore(
+        ObjectClassStore::create(Fom::Seaplane::getAttributesNames(), 1));
+    up_subscribed->setStore(
+        ObjectClassStore::create(Fom::Seaplane::getAttributesNames(), 1));
+  }
+
+  // Handles are set by the RTI when joining.
+  for (auto i = 0UL; i < attributes_number; ++i) {
+    up_published->getAttributes()[i]->setHandle(10 + i);
+    up_subscribed->getAttributes()[i]->setHandle(10 + i);
+  }
+  up_subscribed->initAttributesMap();
+
+  Fom::Seaplane sent{};
+  sent.x() = 1.5;
+  sent.y() = -2.25;
+  sent.float_() = 3.;
+  writeFomValues(*up_published, sent);
+  if (stored) {
+    const auto &sp_store = up_published->getStore();
+    SEAPLANES_CHECK(sp_store->getValue(sp_store->getColumn("y"),
+                                       up_published->getStoreSlot()) ==
+                    sent.y());
+    SEAPLANES_CHECK(up_published->getAttributes()[Fom::Seaplane::Index::y]
+                        ->getValue<double>() == 0.);
+  }
+
+  // Values are sent in network byte order, a value per attribute handle.
+  vector<double> values(attributes_number);
+  vector<unsigned char> encoded(attributes_number * ByteOrder::value_size);
+  for (auto i = 0UL; i < attributes_number; ++i) {
+    values[i] = up_published->getAttributeValue(i);
+  }
+  ByteOrder::encode(values.data(), encoded.data(), attributes_number);
+  std::unique_ptr<RTI::AttributeHandleValuePairSet> up_values(
+      RTI::AttributeSetFactory::create(attributes_number));
+  for (auto i = 0UL; i < attributes_number; ++i) {
+    up_values->add(up_published->getAttributes()[i]->getHandle(),
+                   reinterpret_cast<char *>(encoded.data() +
+                                            i * ByteOrder::value_size),
+                   ByteOrder::value_size);
+  }
+
+  up_subscribed->reflectAttributeValues(*up_values, 1_s, true);
+  SEAPLANES_CHECK(up_subscribed->swapBuffers(1_s) == attributes_number);
+
+  Fom::Seaplane received{};
+  readFomValues(*up_subscribed, received);
+  SEAPLANES_CHECK(received.values == sent.values);
+  SEAPLANES_CHECK(received.float_() == 3.);
+}
+
+} // namespace
+
+int main() {
+  testIndexes();
+  testObjectClass();
+  testRoundTrip(false);
+  testRoundTrip(true);
+  return (EXIT_SUCCESS);
+}
@@ -0,0 +1,127 @@
+//! \file    LogicalProcessorInteractionTest.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Interactions parameters and encoding tests.
+//!
+//! Typed parameters are set by index and by name, encoded in network byte
+//! order as an interaction is sent, then decoded to another interaction, the
+//! unknown parameters ignored and the missing ones set to zero.
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <LogicalProcessorByteOrder.h>
+#include <LogicalProcessorInteraction.h>
+#include <SeaplanesTest.h>
+
+using Seaplanes::ByteOrder;
+using Seaplanes::Interaction;
+using Seaplanes::InteractionClass;
+using Seaplanes::SpInteractionClass;
+using std::size_t;
+using std::vector;
+
+namespace {
+
+//! Handle of the first parameter, as set by the RTI when joining.
+constexpr RTI::ParameterHandle first_handle = 20;
+
+//! \brief Build the interaction class of the tests: a failure, with its
+//! code, severity and delay.
+//! \return The interaction class.
+SpInteractionClass failureClass() {
+  auto sp_failure = InteractionClass::create("Failure");
+  sp_failure->addParameter("code");
+  sp_failure->addParameter("severity");
+  sp_failure->addParameter("delay");
+  for (auto i = 0UL; i < sp_failure->getParametersNumber(); ++i) {
+    sp_failure->setParameterHandle(i, first_handle + i);
+  }
+  return (sp_failure);
+}
+
+//! \brief Check the parameters indexes and handles.
+void testInteractionClass() {
+  const auto sp_failure = failureClass();
+  SEAPLANES_CHECK(sp_failure->getParametersNumber() == 3);
+  SEAPLANES_CHECK(sp_failure->getParameterIndex("severity") == 1);
+  SEAPLANES_CHECK(sp_failure->getParameterHandle(2) == first_handle + 2);
+  SEAPLANES_CHECK(sp_failure->findParameterIndex(first_handle + 2) == 2);
+  SEAPLANES_CHECK(sp_failure->findParameterIndex(first_handle + 3) ==
+                  InteractionClass::no_parameter);
+  SEAPLANES_CHECK_THROW(sp_failure->getParameterIndex("mode"),
+                        std::invalid_argument);
+}
+
+//! \brief Check the parameters set and read, by index and by name.
+void testParameters() {
+  Interaction failure(failureClass());
+  SEAPLANES_CHECK(failure.getParameter<int>(0) == 0);
+
+  failure.setParameter(0, 42);
+  failure.setParameter("severity", 2.5);
+  failure.setParameter("delay", true);
+  SEAPLANES_CHECK(failure.getParameter<int>("code") == 42);
+  SEAPLANES_CHECK(failure.getParameter<double>(1) == 2.5);
+  SEAPLANES_CHECK(failure.getParameter<bool>("delay"));
+  SEAPLANES_CHECK_THROW(failure.setParameter("mode", 1), std::invalid_argument);
+  SEAPLANES_CHECK_THROW(failure.getParameter<int>("mode"),
+                        std::invalid_argument);
+}
+
+//! \brief Encode the parameters of an interaction, as sent, and decode them
+//! to another interaction, as received.
+void testRoundTrip() {
+  const auto sp_failure = failureClass();
+  const auto count = sp_failure->getParametersNumber();
+  Interaction sent(sp_failure);
+  sent.setParameter("code", 7);
+  sent.setParameter("severity", -1.25);
+  sent.setParameter("delay", 1e-3);
+
+  std::unique_ptr<RTI::ParameterHandleValuePairSet> up_parameters(
+      RTI::ParameterSetFactory::create(count));
+  vector<unsigned char> encoded(count * ByteOrder::value_size);
+  sent.encodeParameters(*up_parameters, encoded);
+  SEAPLANES_CHECK(up_parameters->size() == count);
+  SEAPLANES_CHECK(up_parameters->getHandle(1) == first_handle + 1);
+
+  // Values are sent in network byte order.
+  double severity = 0.;
+  ByteOrder::decode(encoded.data() + ByteOrder::value_size, &severity, 1);
+  SEAPLANES_CHECK(severity == -1.25);
+
+  Interaction received(sp_failure);
+  received.setParameter("severity", 9.);
+  received.decodeParameters(*up_parameters);
+  for (auto i = 0UL; i < count; ++i) {
+    SEAPLANES_CHECK(received.getParameter<double>(i) ==
+                    sent.getParameter<double>(i));
+  }
+
+  // Unknown parameters are ignored, missing ones set to zero.
+  std::unique_ptr<RTI::ParameterHandleValuePairSet> up_partial(
+      RTI::ParameterSetFactory::create(2));
+  up_partial->add(first_handle + count,
+                  reinterpret_cast<char *>(encoded.data()),
+                  ByteOrder::value_size);
+  up_partial->add(first_handle + 2,
+                  reinterpret_cast<char *>(encoded.data() +
+                                           2 * ByteOrder::value_size),
+                  ByteOrder::value_size);
+  received.decodeParameters(*up_partial);
+  SEAPLANES_CHECK(received.getParameter<int>("code") == 0);
+  SEAPLANES_CHECK(received.getParameter<double>("severity") == 0.);
+  SEAPLANES_CHECK(received.getParameter<double>("delay") == 1e-3);
+}
+
+} // namespace
+
+int main() {
+  testInteractionClass();
+  testParameters();
+  testRoundTrip();
+  return (EXIT_SUCCESS);
+}
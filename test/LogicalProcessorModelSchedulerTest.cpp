@@ -0,0 +1,273 @@
+//! \file    LogicalProcessorModelSchedulerTest.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Models scheduling and parallel execution tests.
+//!
+//! A monitor, independent, and a sensor, a controller and a plant, in a loop
+//! closed by a delayed input of the sensor, are declared out of order. They
+//! are run in dependency order, the delayed input reading the value of the
+//! previous step, sequentially and on several threads, in both modes. Models
+//! reading the same attribute each see its new values as fresh.
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <LogicalProcessorExecutor.h>
+#include <LogicalProcessorModelScheduler.h>
+#include <SeaplanesTest.h>
+
+using Seaplanes::Attribute;
+using Seaplanes::Executor;
+using Seaplanes::Model;
+using Seaplanes::ModelScheduler;
+using Seaplanes::SpAttribute;
+using Seaplanes::UpExecutor;
+using std::size_t;
+using std::vector;
+
+namespace {
+
+//! Number of steps run.
+constexpr unsigned int steps_number = 8;
+
+//! Number of threads of the parallel executions.
+constexpr unsigned int threads_number = 4;
+
+//! \brief Affine model, writing a * input + b, the inputs summed.
+class AffineModel final : public Model {
+public:
+  //! \brief Affine model constructor.
+  //! \param name The name of the model.
+  //! \param a The factor of the inputs.
+  //! \param b The offset.
+  AffineModel(Name name, double a, double b)
+      : Model(std::move(name)), __a_(a), __b_(b),
+        __sp_inputs_(vector<SpAttribute>()), __sp_output_(nullptr) {}
+
+  //! \brief Declare an input port.
+  //! \param sp_attribute The attribute bound to the port.
+  //! \param delayed True for a delayed input.
+  void input(SpAttribute sp_attribute, bool delayed) {
+    __sp_inputs_.push_back(addInput(std::move(sp_attribute), delayed));
+  }
+
+  //! \brief Declare the output port.
+  //! \param sp_attribute The attribute bound to the port.
+  void output(SpAttribute sp_attribute) {
+    __sp_output_ = sp_attribute;
+    addOutput(std::move(sp_attribute));
+  }
+
+  void compute() override {
+    auto sum = 0.;
+    for (const auto &sp_input : __sp_inputs_) {
+      sum += sp_input->getValue<double>();
+    }
+    if (__sp_output_) {
+      __sp_output_->setValue(__a_ * sum + __b_);
+    }
+  }
+
+private:
+  double __a_;                      //!< Factor of the inputs.
+  double __b_;                      //!< Offset.
+  vector<SpAttribute> __sp_inputs_; //!< Attributes read.
+  SpAttribute __sp_output_;         //!< Attribute written.
+};
+
+//! \brief Model reading an input as a sample, recording its freshness.
+class ReaderModel final : public Model {
+public:
+  //! \brief Reader model constructor.
+  //! \param name The name of the model.
+  //! \param sp_attribute The attribute read.
+  ReaderModel(Name name, SpAttribute sp_attribute)
+      : Model(std::move(name)), __sp_input_(addInput(std::move(sp_attribute))),
+        __fresh_(vector<bool>()) {}
+
+  void compute() override {
+    __fresh_.push_back(__sp_input_->getSample<double>().fresh);
+  }
+
+  //! \brief Freshness of the samples read getter.
+  //! \return The freshness of the sample read at each step.
+  const vector<bool> &getFresh() const { return (__fresh_); }
+
+private:
+  SpAttribute __sp_input_; //!< Attribute read.
+  vector<bool> __fresh_;   //!< Freshness of the samples read.
+};
+
+//! \brief Models of the test, with their attributes.
+struct Loop {
+  SpAttribute sp_sensed{Attribute::create("sensed")};   //!< Sensor output.
+  SpAttribute sp_command{Attribute::create("command")}; //!< Control output.
+  SpAttribute sp_state{Attribute::create("state")};     //!< Plant output.
+  ModelScheduler scheduler{};                           //!< Scheduler.
+};
+
+//! \brief Declare the models of the loop: monitor, control, plant and
+//! sensor, in this order, the sensor reading the plant state of the previous
+//! step.
+//! \param loop The loop.
+void declare(Loop &loop) {
+  auto sp_monitor = std::make_shared<AffineModel>("monitor", 0., 0.);
+  auto sp_control = std::make_shared<AffineModel>("control", 2., 0.);
+  auto sp_plant = std::make_shared<AffineModel>("plant", 1., 1.);
+  auto sp_sensor = std::make_shared<AffineModel>("sensor", 1., 1.);
+  sp_control->input(loop.sp_sensed, false);
+  sp_control->output(loop.sp_command);
+  sp_plant->input(loop.sp_command, false);
+  sp_plant->output(loop.sp_state);
+  sp_sensor->input(loop.sp_state, true);
+  sp_sensor->output(loop.sp_sensed);
+
+  loop.scheduler.addModel(sp_monitor);
+  loop.scheduler.addModel(sp_control);
+  loop.scheduler.addModel(sp_plant);
+  loop.scheduler.addModel(sp_sensor);
+  loop.scheduler.order();
+}
+
+//! \brief Plant state expected after a step, the sensor reading the state of
+//! the previous step: state = 2 * (previous state + 1) + 1.
+//! \param step The step, from 1.
+//! \return The expected state.
+double expectedState(unsigned int step) {
+  auto state = 0.;
+  for (auto i = 0U; i < step; ++i) {
+    state = 2. * (state + 1.) + 1.;
+  }
+  return (state);
+}
+
+//! \brief Check the dependency order, the independent models keeping their
+//! declaration order, and the delayed input ordering.
+void testOrder() {
+  Loop loop;
+  declare(loop);
+
+  // Monitor, sensor, control, plant.
+  SEAPLANES_CHECK(loop.scheduler.getOrder() == (vector<size_t>{0, 3, 1, 2}));
+  SEAPLANES_CHECK(loop.scheduler.getSuccessors(3) == vector<size_t>{1});
+  SEAPLANES_CHECK(loop.scheduler.getSuccessors(1) == vector<size_t>{2});
+  SEAPLANES_CHECK(loop.scheduler.getSuccessors(0).empty());
+  SEAPLANES_CHECK(loop.scheduler.getPredecessorsNumber(3) == 0);
+  SEAPLANES_CHECK(loop.scheduler.getPredecessorsNumber(2) == 1);
+
+  // The sensor, reading the plant state delayed, comes first.
+  SEAPLANES_CHECK(loop.scheduler.getDelayedSuccessors(3) == vector<size_t>{2});
+  SEAPLANES_CHECK(loop.scheduler.getDelayedPredecessorsNumber(2) == 1);
+  SEAPLANES_CHECK(loop.scheduler.getDelayedPredecessorsNumber(3) == 0);
+}
+
+//! \brief Check that the models are refused when they cannot be ordered.
+void testErrors() {
+  const auto sp_value = Attribute::create("value");
+  auto sp_first = std::make_shared<AffineModel>("first", 1., 0.);
+  auto sp_second = std::make_shared<AffineModel>("second", 1., 0.);
+  sp_first->output(sp_value);
+  sp_second->output(sp_value);
+  ModelScheduler writers;
+  writers.addModel(sp_first);
+  writers.addModel(sp_second);
+  SEAPLANES_CHECK_THROW(writers.order(), std::logic_error);
+
+  const auto sp_x = Attribute::create("x");
+  const auto sp_y = Attribute::create("y");
+  auto sp_x_model = std::make_shared<AffineModel>("x", 1., 0.);
+  auto sp_y_model = std::make_shared<AffineModel>("y", 1., 0.);
+  sp_x_model->input(sp_y, false);
+  sp_x_model->output(sp_x);
+  sp_y_model->input(sp_x, false);
+  sp_y_model->output(sp_y);
+  ModelScheduler loop;
+  loop.addModel(sp_x_model);
+  loop.addModel(sp_y_model);
+  SEAPLANES_CHECK_THROW(loop.order(), std::logic_error);
+}
+
+//! \brief Check the values of the sequential run, the delayed input reading
+//! the value of the previous step.
+void testSequentialRun() {
+  Loop loop;
+  declare(loop);
+  for (auto step = 1U; step <= steps_number; ++step) {
+    loop.scheduler.run();
+    SEAPLANES_CHECK(loop.sp_state->getValue<double>() == expectedState(step));
+  }
+}
+
+//! \brief Check that the parallel runs compute the values of the sequential
+//! one.
+//! \param deterministic True for the deterministic mode, else false.
+void testParallelRun(bool deterministic) {
+  Loop loop;
+  declare(loop);
+  auto up_executor = Executor::create(threads_number, deterministic);
+  up_executor->setup(loop.scheduler);
+  for (auto step = 1U; step <= steps_number; ++step) {
+    up_executor->run();
+    SEAPLANES_CHECK(loop.sp_state->getValue<double>() == expectedState(step));
+    SEAPLANES_CHECK(loop.sp_sensed->getValue<double>() ==
+                    expectedState(step - 1) + 1.);
+  }
+}
+
+//! \brief Check that models reading the same attribute, in parallel, each
+//! see its new values as fresh, and only once.
+//! \param threads The number of threads, sequential run if zero.
+void testSharedInput(unsigned int threads) {
+  const auto sp_value = Attribute::create("value");
+  auto sp_first = std::make_shared<ReaderModel>("first", sp_value);
+  auto sp_second = std::make_shared<ReaderModel>("second", sp_value);
+  ModelScheduler scheduler;
+  scheduler.addModel(sp_first);
+  scheduler.addModel(sp_second);
+  scheduler.order();
+  SEAPLANES_CHECK(scheduler.getPredecessorsNumber(1) == 0);
+
+  UpExecutor up_executor;
+  if (threads > 0) {
+    up_executor = Executor::create(threads, true);
+    up_executor->setup(scheduler);
+  }
+  const auto run = [&] {
+    if (up_executor) {
+      up_executor->run();
+    } else {
+      scheduler.run();
+    }
+  };
+
+  // Set, then read twice, then set again.
+  sp_value->setValue(1.);
+  run();
+  run();
+  sp_value->setValue(2.);
+  run();
+  const vector<bool> expected{true, false, true};
+  SEAPLANES_CHECK(sp_first->getFresh() == expected);
+  SEAPLANES_CHECK(sp_second->getFresh() == expected);
+
+  // The reads of both models are accounted to the attribute.
+  sp_first->readsAccounting();
+  sp_second->readsAccounting();
+  SEAPLANES_CHECK(sp_value->getStaleness().reads == 6);
+  SEAPLANES_CHECK(sp_value->getStaleness().stale_reads == 2);
+}
+
+} // namespace
+
+int main() {
+  testOrder();
+  testErrors();
+  testSequentialRun();
+  testParallelRun(true);
+  testParallelRun(false);
+  testSharedInput(0);
+  testSharedInput(threads_number);
+  return (EXIT_SUCCESS);
+}
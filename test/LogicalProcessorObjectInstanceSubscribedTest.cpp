@@ -0,0 +1,151 @@
+//! \file    LogicalProcessorObjectInstanceSubscribedTest.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Subscribed object instances buffers tests.
+//!
+//! Reflections are written to the back buffer, and only reach the attributes
+//! when the buffers are swapped, the last value of an attribute winning. The
+//! time stamped values of the back buffer are discarded on rollbacks, the
+//! values received in order being kept.
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <LogicalProcessorByteOrder.h>
+#include <LogicalProcessorObjectClass.h>
+#include <LogicalProcessorObjectInstanceSubscribed.h>
+#include <SeaplanesTest.h>
+
+using Seaplanes::Attribute;
+using Seaplanes::ByteOrder;
+using Seaplanes::Object;
+using Seaplanes::ObjectInstanceSubscribed;
+using Seaplanes::SeaplanesTime;
+using Seaplanes::UpObjectInstanceSubscribed;
+using Seaplanes::operator"" _s;
+using std::size_t;
+using std::vector;
+
+namespace {
+
+//! Handle of the first attribute, as set by the RTI when joining.
+constexpr RTI::AttributeHandle first_handle = 10;
+
+//! Indexes of the attributes.
+enum Index : size_t { x, y, z, attributes_number };
+
+//! \brief Build a subscribed object instance of three attributes.
+//! \return The object instance.
+UpObjectInstanceSubscribed subscribed() {
+  auto up_instance = ObjectInstanceSubscribed::create(
+      "aircraft", Object::create("Aircraft"));
+  for (const auto *const name : {"x", "y", "z"}) {
+    up_instance->addAttribute(Attribute::create(name));
+  }
+  for (auto i = 0UL; i < attributes_number; ++i) {
+    up_instance->getAttributes()[i]->setHandle(first_handle + i);
+  }
+  up_instance->initAttributesMap();
+  return (up_instance);
+}
+
+//! \brief Reflect values to an object instance, encoded as sent.
+//! \param instance The object instance.
+//! \param values The attributes indexes and their values.
+//! \param time The time stamp of the reflection.
+//! \param time_stamped True if time stamped, false if received in order.
+void reflect(ObjectInstanceSubscribed &instance,
+             const vector<std::pair<size_t, double>> &values,
+             SeaplanesTime time, bool time_stamped) {
+  vector<unsigned char> encoded(values.size() * ByteOrder::value_size);
+  std::unique_ptr<RTI::AttributeHandleValuePairSet> up_values(
+      RTI::AttributeSetFactory::create(values.size()));
+  for (auto i = 0UL; i < values.size(); ++i) {
+    auto *const p_bytes = encoded.data() + i * ByteOrder::value_size;
+    ByteOrder::encode(&values[i].second, p_bytes, 1);
+    up_values->add(first_handle + values[i].first,
+                   reinterpret_cast<char *>(p_bytes), ByteOrder::value_size);
+  }
+  instance.reflectAttributeValues(*up_values, time, time_stamped);
+}
+
+//! \brief Value of an attribute.
+//! \param instance The object instance.
+//! \param index The attribute index.
+//! \return The value.
+double value(const ObjectInstanceSubscribed &instance, size_t index) {
+  return (instance.getAttributes()[index]->getValue<double>());
+}
+
+//! \brief Check that the values reach the attributes at the swaps only, the
+//! last value of an attribute winning.
+void testSwap() {
+  auto up_instance = subscribed();
+  reflect(*up_instance, {{x, 1.}, {y, 2.}}, 1_s, true);
+  SEAPLANES_CHECK(value(*up_instance, x) == 0.);
+
+  SEAPLANES_CHECK(up_instance->swapBuffers(1_s) == 2);
+  SEAPLANES_CHECK(value(*up_instance, x) == 1.);
+  SEAPLANES_CHECK(value(*up_instance, y) == 2.);
+  const auto &sp_attributes = up_instance->getAttributes();
+  SEAPLANES_CHECK(sp_attributes[x]->getState().time == 1_s);
+  SEAPLANES_CHECK(sp_attributes[x]->getState().age == 0);
+  SEAPLANES_CHECK(sp_attributes[z]->getState().age == 1);
+
+  // The other buffer is written, a value overwriting the previous one.
+  reflect(*up_instance, {{x, 3.}}, 2_s, true);
+  reflect(*up_instance, {{x, 4.}}, 2_s, true);
+  SEAPLANES_CHECK(up_instance->swapBuffers(2_s) == 1);
+  SEAPLANES_CHECK(value(*up_instance, x) == 4.);
+  SEAPLANES_CHECK(value(*up_instance, y) == 2.);
+  SEAPLANES_CHECK(sp_attributes[y]->getState().age == 1);
+
+  // Both buffers emptied by their swaps.
+  SEAPLANES_CHECK(up_instance->swapBuffers(3_s) == 0);
+  SEAPLANES_CHECK(up_instance->swapBuffers(4_s) == 0);
+  SEAPLANES_CHECK(value(*up_instance, x) == 4.);
+  SEAPLANES_CHECK(sp_attributes[x]->getState().age == 2);
+}
+
+//! \brief Check that the time stamped values are discarded, the values
+//! received in order kept, even when overwritten by time stamped ones.
+void testDiscard() {
+  auto up_instance = subscribed();
+  reflect(*up_instance, {{x, 1.}}, 1_s, true);
+  reflect(*up_instance, {{y, 2.}}, 1_s, false);
+  reflect(*up_instance, {{z, 3.}}, 1_s, false);
+  reflect(*up_instance, {{z, 4.}}, 2_s, true);
+  up_instance->discardBuffers();
+
+  SEAPLANES_CHECK(up_instance->swapBuffers(2_s) == 2);
+  SEAPLANES_CHECK(value(*up_instance, x) == 0.);
+  SEAPLANES_CHECK(value(*up_instance, y) == 2.);
+  SEAPLANES_CHECK(value(*up_instance, z) == 3.);
+  SEAPLANES_CHECK(up_instance->getAttributes()[z]->getState().time == 1_s);
+
+  // A value received in order overwrites a time stamped one.
+  reflect(*up_instance, {{x, 5.}}, 3_s, true);
+  reflect(*up_instance, {{x, 6.}}, 3_s, false);
+  up_instance->discardBuffers();
+  SEAPLANES_CHECK(up_instance->swapBuffers(3_s) == 1);
+  SEAPLANES_CHECK(value(*up_instance, x) == 6.);
+
+  // The values discarded are not written, nor kept for the next swaps.
+  reflect(*up_instance, {{x, 7.}, {y, 8.}}, 4_s, true);
+  up_instance->discardBuffers();
+  reflect(*up_instance, {{y, 9.}}, 4_s, true);
+  SEAPLANES_CHECK(up_instance->swapBuffers(4_s) == 1);
+  SEAPLANES_CHECK(value(*up_instance, x) == 6.);
+  SEAPLANES_CHECK(value(*up_instance, y) == 9.);
+  SEAPLANES_CHECK(up_instance->swapBuffers(5_s) == 0);
+}
+
+} // namespace
+
+int main() {
+  testSwap();
+  testDiscard();
+  return (EXIT_SUCCESS);
+}
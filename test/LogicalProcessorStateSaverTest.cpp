@@ -0,0 +1,141 @@
+//! \file    LogicalProcessorStateSaverTest.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Incremental state saving and rollback tests.
+//!
+//! The attributes are checkpointed at each step, then rolled back to older
+//! checkpoints: their values, time stamps and ages are restored, the changes
+//! since the newest checkpoint discarded, and the messages sent since the
+//! restored checkpoint returned to be retracted.
+
+#include <vector>
+
+#include <LogicalProcessorStateSaver.h>
+#include <SeaplanesTest.h>
+
+using Seaplanes::Attribute;
+using Seaplanes::SeaplanesTime;
+using Seaplanes::StateSaver;
+using Seaplanes::VecEventRetractionHandle;
+using Seaplanes::operator"" _s;
+using Seaplanes::operator"" _ms;
+
+namespace {
+
+//! \brief Build a retraction handle.
+//! \param serial The serial number of the handle.
+//! \return The retraction handle.
+RTI::EventRetractionHandle handle(RTI::ULong serial) {
+  RTI::EventRetractionHandle retraction_handle{};
+  retraction_handle.theSerialNumber = serial;
+  return (retraction_handle);
+}
+
+//! \brief Serial numbers of retraction handles.
+//! \param handles The retraction handles.
+//! \return The serial numbers, in order.
+std::vector<RTI::ULong> serials(const VecEventRetractionHandle &handles) {
+  std::vector<RTI::ULong> numbers;
+  for (const auto &retraction_handle : handles) {
+    numbers.push_back(retraction_handle.theSerialNumber);
+  }
+  return (numbers);
+}
+
+//! \brief Check the checkpoints, the rollbacks to them and the messages sent
+//! since them.
+void testRollback() {
+  const auto sp_x = Attribute::create("x");
+  const auto sp_y = Attribute::create("y");
+  StateSaver saver;
+  saver.track({sp_x, sp_y});
+
+  // Step 1, a message sent.
+  sp_x->setValue(1.);
+  sp_y->setReceived(500_ms);
+  saver.checkpoint(1_s, 1);
+  saver.recordSent({handle(1)});
+
+  // Step 2, y aged, two messages sent.
+  sp_x->setValue(2.);
+  sp_y->incrementAge();
+  sp_y->incrementAge();
+  saver.checkpoint(2_s, 2);
+  saver.recordSent({handle(2), handle(3)});
+
+  // Step 3, y received again, a message sent.
+  sp_x->setValue(3.);
+  sp_y->setReceived(2500_ms);
+  saver.checkpoint(3_s, 3);
+  saver.recordSent({handle(4)});
+  SEAPLANES_CHECK(saver.size() == 3);
+
+  auto checkpoint_time = 0_s;
+  SEAPLANES_CHECK(saver.findCheckpoint(1500_ms, checkpoint_time));
+  SEAPLANES_CHECK(checkpoint_time == 2_s);
+  SEAPLANES_CHECK(!saver.findCheckpoint(4_s, checkpoint_time));
+
+  // Back to step 2, the change since the step 3 discarded.
+  sp_x->setValue(5.);
+  auto step_number = 0ULL;
+  VecEventRetractionHandle sent;
+  saver.rollback(2_s, step_number, sent);
+  SEAPLANES_CHECK(step_number == 2);
+  SEAPLANES_CHECK(saver.size() == 2);
+  SEAPLANES_CHECK(sp_x->getValue<double>() == 2.);
+  SEAPLANES_CHECK(sp_y->getState().time == 500_ms);
+  SEAPLANES_CHECK(sp_y->getState().age == 2);
+  SEAPLANES_CHECK(serials(sent) == (std::vector<RTI::ULong>{4, 2, 3}));
+
+  // The messages of step 2 are retracted once.
+  sp_x->setValue(6.);
+  sent.clear();
+  saver.rollback(2_s, step_number, sent);
+  SEAPLANES_CHECK(sp_x->getValue<double>() == 2.);
+  SEAPLANES_CHECK(sent.empty());
+
+  // Back to step 1.
+  saver.rollback(1_s, step_number, sent);
+  SEAPLANES_CHECK(step_number == 1);
+  SEAPLANES_CHECK(saver.size() == 1);
+  SEAPLANES_CHECK(sp_x->getValue<double>() == 1.);
+  SEAPLANES_CHECK(sp_y->getState().age == 0);
+  SEAPLANES_CHECK(serials(sent) == (std::vector<RTI::ULong>{1}));
+}
+
+//! \brief Check that the checkpoints older than the time are discarded, the
+//! newest of them kept to be restored.
+void testFossilCollect() {
+  const auto sp_x = Attribute::create("x");
+  StateSaver saver;
+  saver.track({sp_x});
+
+  // Messages sent before the first checkpoint are not recorded.
+  saver.recordSent({handle(1)});
+  for (auto step = 1ULL; step <= 3; ++step) {
+    sp_x->setValue(static_cast<double>(step));
+    saver.checkpoint(SeaplanesTime(step * 1000000ULL), step);
+  }
+
+  saver.fossilCollect(2500_ms);
+  SEAPLANES_CHECK(saver.size() == 2);
+  auto checkpoint_time = 0_s;
+  SEAPLANES_CHECK(saver.findCheckpoint(0_s, checkpoint_time));
+  SEAPLANES_CHECK(checkpoint_time == 2_s);
+
+  auto step_number = 0ULL;
+  VecEventRetractionHandle sent;
+  saver.rollback(2_s, step_number, sent);
+  SEAPLANES_CHECK(step_number == 2);
+  SEAPLANES_CHECK(sp_x->getValue<double>() == 2.);
+  SEAPLANES_CHECK(sent.empty());
+}
+
+} // namespace
+
+int main() {
+  testRollback();
+  testFossilCollect();
+  return (EXIT_SUCCESS);
+}
@@ -0,0 +1,49 @@
+//! \file    SeaplanesTest.h
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Behaviour tests checks.
+//!
+//! The checks stop the test at the first failure, with its location, whatever
+//! the build type, NDEBUG included.
+
+#ifndef SEAPLANESTEST_H
+#define SEAPLANESTEST_H
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+//! \brief Check a condition, the test failing if false.
+//! \param condition The condition.
+#define SEAPLANES_CHECK(condition)                                             \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << __FILE__ << ":" << __LINE__                                 \
+                << ": check failed: " #condition << std::endl;                 \
+      std::exit(EXIT_FAILURE);                                                 \
+    }                                                                          \
+  } while (false)
+
+//! \brief Check that two values are close, the test failing if not.
+//! \param value The value.
+//! \param expected The expected value.
+//! \param tolerance The absolute tolerance.
+#define SEAPLANES_CHECK_CLOSE(value, expected, tolerance)                      \
+  SEAPLANES_CHECK(std::fabs((value) - (expected)) <= (tolerance))
+
+//! \brief Check that a statement throws an exception, the test failing if not.
+//! \param statement The statement.
+//! \param exception The type of the exception.
+#define SEAPLANES_CHECK_THROW(statement, exception)                            \
+  do {                                                                         \
+    auto thrown = false;                                                       \
+    try {                                                                      \
+      statement;                                                               \
+    } catch (const exception &) {                                              \
+      thrown = true;                                                           \
+    }                                                                          \
+    SEAPLANES_CHECK(thrown && #statement);                                     \
+  } while (false)
+
+#endif // SEAPLANESTEST_H
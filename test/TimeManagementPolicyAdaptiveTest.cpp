@@ -0,0 +1,106 @@
+//! \file    TimeManagementPolicyAdaptiveTest.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Adaptive time management steps tests.
+//!
+//! The next step is scaled from the error estimate of the step computed,
+//! within the growth and shrink limits, then bounded: quantized on the grid
+//! of the shortest step, not shorter than the lookahead, and ending at the
+//! time limit.
+
+#include <SeaplanesTest.h>
+#include <TimeManagementPolicyAdaptive.h>
+
+using Seaplanes::SeaplanesTime;
+using Seaplanes::TimeManagementPolicyAdaptive;
+using Seaplanes::operator"" _s;
+using Seaplanes::operator"" _ms;
+
+namespace {
+
+//! Tolerance of the factors.
+constexpr double tolerance = 1e-12;
+
+//! \brief Bound a step within 10 and 100 ms, with a lookahead of 1 ms.
+//! \param step The step, in seconds.
+//! \param local_time The local time.
+//! \return The bounded step.
+SeaplanesTime bound(double step, SeaplanesTime local_time = 0_s) {
+  return (TimeManagementPolicyAdaptive::boundStep(step, 10_ms, 100_ms, 1_ms,
+                                                  local_time, 10_s));
+}
+
+//! \brief Check the factor of the next step, and its growth and shrink
+//! limits.
+void testGrowthFactor() {
+  // Without error, or far below the tolerance, the step doubles.
+  SEAPLANES_CHECK(TimeManagementPolicyAdaptive::growthFactor(0., 1., 1) == 2.);
+  SEAPLANES_CHECK(TimeManagementPolicyAdaptive::growthFactor(1e-9, 1., 1) ==
+                  2.);
+
+  // At the tolerance, the safety margin only.
+  SEAPLANES_CHECK_CLOSE(TimeManagementPolicyAdaptive::growthFactor(1., 1., 1),
+                        0.9, tolerance);
+
+  // The tolerance over the error, to the power of one over the order plus
+  // one.
+  SEAPLANES_CHECK_CLOSE(TimeManagementPolicyAdaptive::growthFactor(4., 1., 1),
+                        0.45, tolerance);
+  SEAPLANES_CHECK_CLOSE(TimeManagementPolicyAdaptive::growthFactor(2., 1., 0),
+                        0.45, tolerance);
+
+  // Far over the tolerance, the step is divided by five.
+  SEAPLANES_CHECK(TimeManagementPolicyAdaptive::growthFactor(1e6, 1., 1) ==
+                  0.2);
+}
+
+//! \brief Check the bounds and the quantization of the steps.
+void testBounds() {
+  SEAPLANES_CHECK(bound(0.0234) == 20_ms);
+  SEAPLANES_CHECK(bound(0.1) == 100_ms);
+  SEAPLANES_CHECK(bound(1.) == 100_ms);
+  SEAPLANES_CHECK(bound(0.001) == 10_ms);
+  SEAPLANES_CHECK(bound(0.) == 10_ms);
+}
+
+//! \brief Check that the steps are not shorter than the lookahead, rounded up
+//! to the grid of the shortest step.
+void testLookahead() {
+  SEAPLANES_CHECK(TimeManagementPolicyAdaptive::boundStep(
+                      0.012, 10_ms, 100_ms, 25_ms, 0_s, 10_s) == 30_ms);
+  SEAPLANES_CHECK(TimeManagementPolicyAdaptive::boundStep(
+                      0.012, 10_ms, 100_ms, 20_ms, 0_s, 10_s) == 20_ms);
+}
+
+//! \brief Check that the steps end at the time limit.
+void testTimeLimit() {
+  SEAPLANES_CHECK(bound(0.1, 9950_ms) == 50_ms);
+  SEAPLANES_CHECK(bound(0.1, 9995_ms) == 5_ms);
+  // At the time limit, the step is kept.
+  SEAPLANES_CHECK(bound(0.1, 10_s) == 100_ms);
+}
+
+//! \brief Check the next steps, as chosen after each step.
+void testNextStep() {
+  const auto next = [](SeaplanesTime step, double error) {
+    return (bound(step.get_s() *
+                  TimeManagementPolicyAdaptive::growthFactor(error, 1., 1)));
+  };
+  SEAPLANES_CHECK(next(40_ms, 0.) == 80_ms);
+  SEAPLANES_CHECK(next(80_ms, 0.) == 100_ms);
+  SEAPLANES_CHECK(next(100_ms, 4.) == 40_ms);
+  SEAPLANES_CHECK(next(40_ms, 4.) == 10_ms);
+  SEAPLANES_CHECK(next(10_ms, 1e6) == 10_ms);
+}
+
+} // namespace
+
+int main() {
+  testGrowthFactor();
+  testBounds();
+  testLookahead();
+  testTimeLimit();
+  testNextStep();
+  return (EXIT_SUCCESS);
+}
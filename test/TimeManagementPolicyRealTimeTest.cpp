@@ -0,0 +1,81 @@
+//! \file    TimeManagementPolicyRealTimeTest.cpp
+//! \author  Henrick Deschamps (henrick.deschamps [at] isae-supaero [dot] fr)
+//! \version 1.0.0
+//! \date    October, 2026
+//! \brief   Real-time pacing statistics tests.
+//!
+//! The lateness of the steps is accounted in power of two buckets of
+//! microseconds, the early wake-ups in the first one and the longest lateness
+//! in the last one, with its mean and jitter.
+
+#include <SeaplanesTest.h>
+#include <TimeManagementPolicyRealTime.h>
+
+using Seaplanes::RealTimeStatistics;
+
+namespace {
+
+//! Tolerance of the lateness, in nanoseconds.
+constexpr double tolerance = 1e-6;
+
+//! \brief Check the empty statistics.
+void testEmpty() {
+  const RealTimeStatistics statistics;
+  SEAPLANES_CHECK(statistics.steps == 0);
+  SEAPLANES_CHECK(statistics.getMeanLatenessNs() == 0.);
+  SEAPLANES_CHECK(statistics.getJitterNs() == 0.);
+}
+
+//! \brief Check the histogram buckets of the lateness.
+void testHistogram() {
+  RealTimeStatistics statistics;
+  statistics.record(-200, false); // Early wake-up.
+  statistics.record(500, false);  // Below 1us.
+  statistics.record(1000, false); // [1us, 2us[.
+  statistics.record(1999, false); // [1us, 2us[.
+  statistics.record(3000, true);  // [2us, 4us[.
+  statistics.record(1000000000000LL, true);
+
+  const auto &histogram = statistics.histogram;
+  SEAPLANES_CHECK(histogram[0] == 2);
+  SEAPLANES_CHECK(histogram[1] == 2);
+  SEAPLANES_CHECK(histogram[2] == 1);
+  SEAPLANES_CHECK(histogram[RealTimeStatistics::histogram_size - 1] == 1);
+
+  unsigned long long counted = 0;
+  for (const auto count : histogram) {
+    counted += count;
+  }
+  SEAPLANES_CHECK(counted == statistics.steps);
+  SEAPLANES_CHECK(statistics.steps == 6);
+  SEAPLANES_CHECK(statistics.overruns == 2);
+  SEAPLANES_CHECK(statistics.min_lateness_ns == -200);
+  SEAPLANES_CHECK(statistics.max_lateness_ns == 1000000000000LL);
+}
+
+//! \brief Check the mean and the jitter, the standard deviation of the
+//! lateness.
+void testJitter() {
+  RealTimeStatistics statistics;
+  statistics.record(1000, false);
+  statistics.record(3000, false);
+  SEAPLANES_CHECK_CLOSE(statistics.getMeanLatenessNs(), 2000., tolerance);
+  SEAPLANES_CHECK_CLOSE(statistics.getJitterNs(), 1000., tolerance);
+
+  // A constant lateness has no jitter.
+  RealTimeStatistics constant;
+  for (auto i = 0; i < 10; ++i) {
+    constant.record(700, false);
+  }
+  SEAPLANES_CHECK_CLOSE(constant.getMeanLatenessNs(), 700., tolerance);
+  SEAPLANES_CHECK_CLOSE(constant.getJitterNs(), 0., tolerance);
+}
+
+} // namespace
+
+int main() {
+  testEmpty();
+  testHistogram();
+  testJitter();
+  return (EXIT_SUCCESS);
+}